@@ -0,0 +1,86 @@
+/*	Round-trip benchmark of 'json_dtoa()' against printf("%.17g"), both read back with strtod.
+
+	cc -O2 -I.. dtoa.c ../json.c -o dtoa -lm -pthread && ./dtoa  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "json.h"
+
+#define COUNT 1000000
+
+static json_uint64_t state;
+
+/*	xorshift64, random bit patterns cover every exponent  */
+static double random_double()
+{
+	double value;
+
+	do
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		memcpy(&value, &state, sizeof(value));
+	} while (value != value || value - value != 0.0);
+
+	return value;
+}
+
+static double seconds(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main()
+{
+	double* values = malloc(sizeof(double) * COUNT);
+	char buffer[JSON_DTOA_SIZE];
+	size_t dtoa_len = 0, printf_len = 0;
+	int i, errors = 0;
+	clock_t start;
+
+	if (values == NULL)
+		return 1;
+
+	state = ((json_uint64_t)0x0139408D << 32) | 0xCBBF7A44;
+
+	for (i = 0; i < COUNT; i++)
+		values[i] = i & 1 ? random_double() : (double)(rand() % 100000) / 100.0;
+
+	start = clock();
+
+	for (i = 0; i < COUNT; i++)
+		dtoa_len += (size_t)json_dtoa(values[i], buffer, sizeof(buffer));
+
+	printf("json_dtoa  %6.3f s  %5.1f bytes per number\n", seconds(start),
+		(double)dtoa_len / COUNT);
+
+	start = clock();
+
+	for (i = 0; i < COUNT; i++)
+		printf_len += (size_t)sprintf(buffer, "%.17g", values[i]);
+
+	printf("%%.17g      %6.3f s  %5.1f bytes per number\n", seconds(start),
+		(double)printf_len / COUNT);
+
+	/* every number must read back as the same double */
+
+	for (i = 0; i < COUNT; i++)
+	{
+		buffer[json_dtoa(values[i], buffer, sizeof(buffer))] = 0;
+
+		if (strtod(buffer, NULL) != values[i])
+		{
+			if (errors++ < 10)
+				printf("mismatch %.17g -> %s\n", values[i], buffer);
+		}
+	}
+
+	printf("%d of %d numbers do not round-trip\n", errors, COUNT);
+
+	free(values);
+	return errors != 0;
+}
@@ -0,0 +1,117 @@
+/*	Object benchmark, build it once per probing scheme and compare the output:
+
+	cc -O2 -I.. object.c ../json.c -o object_robin_hood -lm -pthread
+	cc -O2 -I.. -DJSON_OBJECT_SWISS object.c ../json.c -o object_swiss -lm -pthread  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "json.h"
+
+#define LOOKUPS 4000000
+
+static char keys[200000][16];
+
+/*	Visits every index below len in a scattered order  */
+static int scatter(int i, int len)
+{
+	return (int)((unsigned int)i * 7919u % (unsigned int)len);
+}
+
+static double seconds(clock_t start)
+{
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/*	Build an object of len keys, then look up present and missing keys  */
+static void probe(int len)
+{
+	json_t object = json_object();
+	clock_t start;
+	int i, found = 0;
+
+	start = clock();
+
+	for (i = 0; i < len; i++)
+		json_object_set(object, keys[i], json_number(i));
+
+	printf("%7d keys  insert %6.1f ns", len, seconds(start) * 1e9 / len);
+
+	start = clock();
+
+	for (i = 0; i < LOOKUPS; i++)
+		found += json_type(json_object_get(object, keys[scatter(i, len)])) == JSON_NUMBER;
+
+	printf("  hit %6.1f ns", seconds(start) * 1e9 / LOOKUPS);
+
+	start = clock();
+
+	/* keys behind the first len are missing */
+
+	for (i = 0; i < LOOKUPS; i++)
+		found += json_type(json_object_get(object, keys[len + scatter(i, len)])) == JSON_NUMBER;
+
+	printf("  miss %6.1f ns\n", seconds(start) * 1e9 / LOOKUPS);
+
+	if (found != LOOKUPS)
+		printf("wrong result %d\n", found);
+
+	json_free(object);
+}
+
+/*	Missed lookups on an object that saw many removals and inserts  */
+static void churn(int len, int cycles)
+{
+	json_t object = json_object();
+	clock_t start;
+	int i, found = 0;
+
+	for (i = 0; i < len; i++)
+		json_object_set(object, keys[i], json_null());
+
+	/* a sliding window, every cycle removes the oldest key and adds a new one */
+
+	for (i = 0; i < cycles; i++)
+	{
+		json_object_erase(object, keys[i % 100000]);
+		json_object_set(object, keys[(i + len) % 100000], json_null());
+	}
+
+	start = clock();
+
+	for (i = 0; i < LOOKUPS; i++)
+		found += json_type(json_object_get(object, keys[100000 + len + i % 1000])) != JSON_NONE;
+
+	printf("%7d keys  miss after %d erase/insert cycles %6.1f ns\n", len, cycles,
+		seconds(start) * 1e9 / LOOKUPS);
+
+	if (found)
+		printf("wrong result %d\n", found);
+
+	json_free(object);
+}
+
+int main()
+{
+	int i;
+
+#if defined(JSON_OBJECT_SWISS)
+	printf("Swiss table\n");
+#else
+	printf("Robin Hood\n");
+#endif
+
+	for (i = 0; i < 200000; i++)
+		sprintf(keys[i], "key_%d", i);
+
+	probe(16);
+	probe(1000);
+	probe(100000);
+
+	churn(200, 0);
+	churn(200, 200000);
+
+	return 0;
+}
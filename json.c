@@ -22,824 +22,7615 @@
 **************************************************************************************************/
 
 #include <assert.h>
+#include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
+#include <locale.h>
+#include <errno.h>
+#include <time.h>
 #include "json.h"
 
-/**************************************************************************************************
-	JSON Value  */
-
-json_t json_object()
-{
-	json_t node = { JSON_NONE };
-	json__object_t* object = malloc(sizeof(json__object_t));
+#if defined(_WIN32)
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#if defined(__linux__) && defined(__GLIBC__) \
+	&& (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+#include <sys/random.h>
+#define JSON__GETRANDOM
+#endif
+
+#if defined(_WIN32)
+/*	RtlGenRandom is exported by advapi32 under this name and has no header  */
+BOOLEAN NTAPI SystemFunction036(PVOID buffer, ULONG len);
+#if defined(_MSC_VER)
+#pragma comment(lib, "advapi32")
+#endif
+#endif
+
+#if !defined(JSON_NO_THREADS) && !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+/*	64 bit constant from two 32 bit halves, C89 has no long long literals  */
+#define JSON__U64(hi, lo) (((json_uint64_t)(hi) << 32) | (json_uint64_t)(lo))
 
-	if (object == NULL)
-		return node;
+/**************************************************************************************************
+	Allocation  */
 
-	*object = json__object_new(0);
+/*	Containers remember the arena they were allocated from. Without an arena the heap is used.  */
 
-	node.type = JSON_OBJECT;
-	node.u.obj = object;
-	return node;
+static void* json__alloc(json_arena_t* arena, size_t size)
+{
+	return arena ? json_arena_alloc(arena, size) : malloc(size);
 }
 
-json_t json_array()
+static void json__dealloc(json_arena_t* arena, void* ptr)
 {
-	json_t node = { JSON_NONE };
-	json__array_t* array = malloc(sizeof(json__array_t));
+	if (arena == NULL)
+		free(ptr);
+}
 
-	if (array == NULL)
-		return node;
+static json__object_t json__object_make(json_arena_t* arena, int len);
+static json__array_t json__array_make(json_arena_t* arena, int len);
+static json__string_t* json__string_alloc(json_arena_t* arena, size_t len);
 
-	*array = json__array_new(0);
+/*	Longest string stored behind its header, see 'json__string_alloc()'  */
+#define JSON__STRING_INLINE 64
+#define JSON__STRING_IS_INLINE(str) ((str)->data == (char*)((str) + 1))
+static json_uint64_t json__mul128(json_uint64_t a, json_uint64_t b, json_uint64_t* hi);
+static void json__tables();
 
-	node.type = JSON_ARRAY;
-	node.u.arr = array;
-	return node;
-}
+/**************************************************************************************************
+	JSON Threads  */
 
-json_t json_string(const char* string)
-{
-	json_t node = { JSON_NONE };
-	json__string_t* data_string = malloc(sizeof(json__string_t));
-	int len = (int)strlen(string);
+/*	Thin layer over POSIX and Windows threads. With JSON_NO_THREADS no thread is ever started and
+	the parallel functions do all work on the calling thread.  */
 
-	if (!data_string)
-		return node;
+#if defined(JSON_NO_THREADS)
 
-	*data_string = json__string_new(len);
+typedef int json__once_t;
+typedef int json__mutex_t;
+typedef int json__cond_t;
+typedef int json__thread_t;
 
-	node.type = JSON_STRING;
-	node.u.str = data_string;
+#define JSON__ONCE_INIT 0
+#define JSON__THREAD_FN(name, arg) static void name(void* arg)
+#define JSON__THREAD_RETURN return
 
-	json_string_append(node, string, len);
-	return node;
+static void json__once(json__once_t* once, void (*init)())
+{
+	if (!*once)
+	{
+		*once = 1;
+		init();
+	}
 }
 
-json_t json_number(double value)
+#define json__mutex_init(mutex) ((void)(mutex))
+#define json__mutex_lock(mutex) ((void)(mutex))
+#define json__mutex_unlock(mutex) ((void)(mutex))
+#define json__mutex_free(mutex) ((void)(mutex))
+#define json__cond_init(cond) ((void)(cond))
+#define json__cond_wait(cond, mutex) ((void)(cond), (void)(mutex))
+#define json__cond_wake(cond) ((void)(cond))
+#define json__cond_free(cond) ((void)(cond))
+#define json__thread_start(thread, fn, arg) ((void)(thread), (void)(fn), (void)(arg), 0)
+#define json__thread_join(thread) ((void)(thread))
+#define json__cpu_count() 1
+
+#elif defined(_WIN32)
+
+typedef INIT_ONCE json__once_t;
+typedef CRITICAL_SECTION json__mutex_t;
+typedef CONDITION_VARIABLE json__cond_t;
+typedef HANDLE json__thread_t;
+
+#define JSON__ONCE_INIT INIT_ONCE_STATIC_INIT
+#define JSON__THREAD_FN(name, arg) static DWORD WINAPI name(LPVOID arg)
+#define JSON__THREAD_RETURN return 0
+
+static BOOL CALLBACK json__once_call(PINIT_ONCE once, PVOID init, PVOID* ctx)
 {
-	json_t node;
-	node.type = JSON_NUMBER;
-	node.u.num = value;
-	return node;
+	(void)once;
+	(void)ctx;
+	((void (*)())init)();
+	return TRUE;
 }
 
-json_t json_bool(int value)
+static void json__once(json__once_t* once, void (*init)())
 {
-	json_t node;
-	node.type = value ? JSON_TRUE : JSON_FALSE;
-	return node;
+	InitOnceExecuteOnce(once, json__once_call, (PVOID)init, NULL);
 }
 
-json_t json_null()
+#define json__mutex_init(mutex) InitializeCriticalSection(mutex)
+#define json__mutex_lock(mutex) EnterCriticalSection(mutex)
+#define json__mutex_unlock(mutex) LeaveCriticalSection(mutex)
+#define json__mutex_free(mutex) DeleteCriticalSection(mutex)
+#define json__cond_init(cond) InitializeConditionVariable(cond)
+#define json__cond_wait(cond, mutex) SleepConditionVariableCS(cond, mutex, INFINITE)
+#define json__cond_wake(cond) WakeAllConditionVariable(cond)
+#define json__cond_free(cond) ((void)(cond))
+#define json__thread_start(thread, fn, arg) \
+	((*(thread) = CreateThread(NULL, 0, fn, arg, 0, NULL)) != NULL)
+
+static void json__thread_join(json__thread_t* thread)
 {
-	json_t node;
-	node.type = JSON_NULL;
-	return node;
+	WaitForSingleObject(*thread, INFINITE);
+	CloseHandle(*thread);
 }
 
-void json_free(json_t value)
+static int json__cpu_count()
 {
-	int i;
-	switch (value.type)
-	{
-	case JSON_OBJECT:
-	{
-		json__object_t* object = value.u.obj;
-
-		for (i = 0; i < object->len; i++)
-		{
-			json_bucket_t* bucket = object->buckets + i;
-			json_free(bucket->val);
-			free((void*)bucket->key);
-		}
-
-		json__object_free(object);
-		free(object);
-		break;
-	}
-	case JSON_ARRAY:
-	{
-		json__array_t* array = value.u.arr;
-
-		for (i = 0; i < array->len; i++)
-		{
-			json_free(array->data[i]);
-		}
-
-		json__array_free(array);
-		free(array);
-		break;
-	}
-	case JSON_STRING:
-		json__string_free(value.u.str);
-		free(value.u.str);
-		break;
-	}
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
 }
 
-/**************************************************************************************************
-	JSON Parser  */
-
-enum json_parse_state
+#else
+
+typedef pthread_once_t json__once_t;
+typedef pthread_mutex_t json__mutex_t;
+typedef pthread_cond_t json__cond_t;
+typedef pthread_t json__thread_t;
+
+#define JSON__ONCE_INIT PTHREAD_ONCE_INIT
+#define JSON__THREAD_FN(name, arg) static void* name(void* arg)
+#define JSON__THREAD_RETURN return NULL
+
+#define json__once(once, init) pthread_once(once, init)
+#define json__mutex_init(mutex) pthread_mutex_init(mutex, NULL)
+#define json__mutex_lock(mutex) pthread_mutex_lock(mutex)
+#define json__mutex_unlock(mutex) pthread_mutex_unlock(mutex)
+#define json__mutex_free(mutex) pthread_mutex_destroy(mutex)
+#define json__cond_init(cond) pthread_cond_init(cond, NULL)
+#define json__cond_wait(cond, mutex) pthread_cond_wait(cond, mutex)
+#define json__cond_wake(cond) pthread_cond_broadcast(cond)
+#define json__cond_free(cond) pthread_cond_destroy(cond)
+#define json__thread_start(thread, fn, arg) (pthread_create(thread, NULL, fn, arg) == 0)
+#define json__thread_join(thread) pthread_join(*(thread), NULL)
+
+static int json__cpu_count()
 {
-	JSON_START = 1 << 0,
-	JSON_OBJECT_START = 1 << 1,
-	JSON_OBJECT_KEY = 1 << 2,
-	JSON_OBJECT_COLON = 1 << 3,
-	JSON_OBJECT_VAL = 1 << 4,
-	JSON_OBJECT_NEXT = 1 << 5,
+	long count = sysconf(_SC_NPROCESSORS_ONLN);
+	return count > 0 ? (int)count : 1;
+}
 
-	JSON_ARRAY_START = 1 << 6,
-	JSON_ARRAY_VAL = 1 << 7,
-	JSON_ARRAY_NEXT = 1 << 8,
-};
+#endif
 
-/*	Map any character to JSON token.  */
-char json_type[256];
+/**************************************************************************************************
+	JSON Key  */
 
-/*	A state mask for every JSON token. Used to tell if a token is valid or out of place.  */
-short json_state_mask[JSON_TOKEN_COUNT];
+/*	Object keys are stored behind a header with their hash, length and a reference count. Keys of
+	a parsed document are interned, objects with equal keys share one copy. Keys of objects with
+	JSON__BORROWED_KEYS have no header.  */
 
-/*	Initialize lookup tables used by the parser.  */
-static void json__tables()
+typedef struct json__key_t
 {
-	static int needs_init = 1;
-	int value_states = JSON_OBJECT_VAL | JSON_ARRAY_START | JSON_ARRAY_VAL;
-	int i;
-
-	if (!needs_init)
-		return;
+	unsigned int hash;
+	int len;
+	int refs;
 
-	/* initialize json type map */
+} json__key_t;
 
-	memset(json_type, JSON_NONE, 256);
+#define JSON__KEY(key) ((json__key_t*)(key) - 1)
 
-	json_type['{'] = JSON_OBJECT;
-	json_type['}'] = JSON_SCOPE_END;
-	json_type['['] = JSON_ARRAY;
-	json_type[']'] = JSON_SCOPE_END;
-	json_type['"'] = JSON_STRING;
-	json_type[':'] = JSON_COLON;
-	json_type[','] = JSON_COMMA;
-	json_type['-'] = JSON_NUMBER;
+/*	Keys are hashed with wyhash (Wang Yi, public domain) and a seed that is random per process,
+	so colliding key sets can not be prepared in advance.  */
 
-	for (i = 0; i < 10; i++)
-		json_type['0' + i] = JSON_NUMBER;
+static json_uint64_t json__seed;
+static int json__seed_ready = 0;
 
-	json_type['t'] = JSON_TRUE;
-	json_type['f'] = JSON_FALSE;
-	json_type['a'] = JSON_NULL;
+static const json_uint64_t json__secret[4] = {
+	JSON__U64(0xa0761d64, 0x78bd642f), JSON__U64(0xe7037ed1, 0xa0b428db),
+	JSON__U64(0x8ebc6af0, 0x9c88c6e3), JSON__U64(0x589965cc, 0x75374cc3)
+};
 
-	/* initialize json task map */
+static json_uint64_t json__wymix(json_uint64_t a, json_uint64_t b)
+{
+	json_uint64_t hi, lo = json__mul128(a, b, &hi);
+	return lo ^ hi;
+}
 
-	json_state_mask[JSON_OBJECT] = JSON_START | value_states;
-	json_state_mask[JSON_ARRAY] = JSON_START | value_states;
-	json_state_mask[JSON_STRING] = JSON_OBJECT_START | JSON_OBJECT_KEY | value_states;
-	json_state_mask[JSON_NUMBER] = value_states;
-	json_state_mask[JSON_TRUE] = value_states;
-	json_state_mask[JSON_FALSE] = value_states;
-	json_state_mask[JSON_NULL] = value_states;
-	json_state_mask[JSON_NONE] = 0;
-	json_state_mask[JSON_COLON] = JSON_OBJECT_COLON;
-	json_state_mask[JSON_COMMA] = JSON_OBJECT_NEXT | JSON_ARRAY_NEXT;
-	json_state_mask[JSON_SCOPE_END] = JSON_OBJECT_START | JSON_OBJECT_NEXT
-		| JSON_ARRAY_START | JSON_ARRAY_NEXT;
+static json_uint64_t json__read64(const unsigned char* p)
+{
+	json_uint64_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
 
-	needs_init = 0;
+static json_uint64_t json__read32(const unsigned char* p)
+{
+	unsigned int value;
+	memcpy(&value, p, sizeof(value));
+	return value;
 }
 
-/*	convert string to json_t  */
-json_t json_parse(const char* text)
+void json_hash_seed(json_uint64_t seed)
 {
-	json_t stack[128] = { {JSON_NONE} };
-	json_t* sp = stack;
+	json__seed = seed ^ json__wymix(seed ^ json__secret[0], json__secret[1]);
+	json__seed_ready = 1;
+}
 
-	const char* key = NULL;
-	json_t val = { JSON_NONE };
+/*	Random bytes of the operating system, 0 if there are none  */
+static int json__entropy(void* buffer, size_t len)
+{
+#if defined(_WIN32)
+	return SystemFunction036(buffer, (ULONG)len) != 0;
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+	arc4random_buf(buffer, len);
+	return 1;
+#else
+	ssize_t n;
+	int fd;
+
+#if defined(JSON__GETRANDOM)
+	if (getrandom(buffer, len, 0) == (ssize_t)len)
+		return 1;
+#endif
+
+	if ((fd = open("/dev/urandom", O_RDONLY)) < 0)
+		return 0;
+
+	n = read(fd, buffer, len);
+	close(fd);
+	return n == (ssize_t)len;
+#endif
+}
 
-	int state = JSON_START;
-	const char* c = text;
+/*	Called once by 'json__tables()' unless a seed was set. Without entropy from the operating
+	system the seed is mixed from the address space layout and the time, which can be guessed.  */
+static void json__seed_random()
+{
+	json_uint64_t seed;
 
-	/* initialize lookup tables */
+	if (!json__entropy(&seed, sizeof(seed)))
+		seed = (json_uint64_t)(size_t)&json__seed ^ ((json_uint64_t)time(NULL) << 32)
+			^ (json_uint64_t)clock();
 
-	json__tables();
+	json_hash_seed(seed);
+}
 
-	/* parse string to json */
+/*	Hash with an explicit seed, snapshots are looked up with the seed they were written with  */
+static unsigned int json__hash(const char* key, size_t len, json_uint64_t seed)
+{
+	const unsigned char* p = (const unsigned char*)key;
+	json_uint64_t a, b;
 
-	while (*(c = json_skip_whitespace(c)))
+	if (len <= 16)
 	{
-		int type = json_type[*c];
-		int flags = 0;
-
-		if (!(state & json_state_mask[type]))
-			goto end;
-
-		/* parse value */
-
-		switch (type)
+		if (len >= 4)
 		{
-		case JSON_OBJECT:
-			val = json_object();
-			flags = 1;
-			c++;
-			break;
+			size_t mid = (len >> 3) << 2;
+			a = (json__read32(p) << 32) | json__read32(p + mid);
+			b = (json__read32(p + len - 4) << 32) | json__read32(p + len - 4 - mid);
+		}
+		else if (len > 0)
+		{
+			a = ((json_uint64_t)p[0] << 16) | ((json_uint64_t)p[len >> 1] << 8) | p[len - 1];
+			b = 0;
+		}
+		else
+			a = b = 0;
+	}
+	else
+	{
+		size_t i = len;
 
-		case JSON_ARRAY:
-			val = json_array();
-			flags = 1;
-			c++;
-			break;
+		if (i > 48)
+		{
+			json_uint64_t see1 = seed, see2 = seed;
 
-		case JSON_STRING:
-			if (state & (JSON_OBJECT_START | JSON_OBJECT_KEY))
-			{
-				key = json_parse_string_value(&c, 0).data;
-				state = JSON_OBJECT_COLON;
-				continue;
-			}
-			else
+			do
 			{
-				val.u.str = malloc(sizeof(json__string_t));
-
-				if (val.u.str == NULL)
-				{
-					goto end;
-				}
+				seed = json__wymix(json__read64(p) ^ json__secret[1], json__read64(p + 8) ^ seed);
+				see1 = json__wymix(json__read64(p + 16) ^ json__secret[2],
+					json__read64(p + 24) ^ see1);
+				see2 = json__wymix(json__read64(p + 32) ^ json__secret[3],
+					json__read64(p + 40) ^ see2);
+				p += 48;
+				i -= 48;
+			} while (i > 48);
+
+			seed ^= see1 ^ see2;
+		}
 
-				val.type = JSON_STRING;
-				*val.u.str = json_parse_string_value(&c, 1);
-				break;
-			}
+		for (; i > 16; i -= 16, p += 16)
+			seed = json__wymix(json__read64(p) ^ json__secret[1], json__read64(p + 8) ^ seed);
 
-		case JSON_NUMBER:
-			val = json_number(strtod(c, (char**)&c));
-			break;
+		a = json__read64(p + i - 16);
+		b = json__read64(p + i - 8);
+	}
 
-		case JSON_TRUE:
-			if (strncmp(c, "true", 4) == 0)
-			{
-				val = json_bool(1);
-				c += 4;
-				break;
-			}
-			goto end;
+	a ^= json__secret[1];
+	b ^= seed;
+	a = json__mul128(a, b, &b);
 
-		case JSON_FALSE:
-			if (strncmp(c, "false", 5) == 0)
-			{
-				val = json_bool(0);
-				c += 5;
-				break;
-			}
-			goto end;
+	return (unsigned int)json__wymix(a ^ json__secret[0] ^ len, b ^ json__secret[1]);
+}
 
-		case JSON_NULL:
-			if (strncmp(c, "null", 4) == 0)
-			{
-				val = json_null();
-				c += 4;
-				break;
-			}
-			goto end;
+/*	Always through 'json__tables()', it publishes the seed to every thread  */
+static unsigned int json__key_hash(const char* key, size_t len)
+{
+	json__tables();
+	return json__hash(key, len, json__seed);
+}
 
-		case JSON_COLON:
-			c++;
-			state = JSON_OBJECT_VAL;
-			continue;
+/*	Allocate a key with room for len characters, hash and length are set by the caller.  */
+static char* json__key_alloc(json_arena_t* arena, size_t len)
+{
+	json__key_t* header = json__alloc(arena, sizeof(json__key_t) + len + 1);
 
-		case JSON_COMMA:
-			c++;
-			state = sp->type == JSON_OBJECT ? JSON_OBJECT_KEY : JSON_ARRAY_VAL;
-			continue;
+	if (header == NULL)
+		return NULL;
 
-		case JSON_SCOPE_END:
-			if (sp-- == stack)
-				goto end;
+	header->refs = 1;
+	return (char*)(header + 1);
+}
 
-			c++;
-			continue;
-		}
+static char* json__key_new(json_arena_t* arena, const char* str, size_t len, unsigned int hash)
+{
+	char* key = json__key_alloc(arena, len);
 
-		/* add value to parent */
+	if (key == NULL)
+		return NULL;
 
-		switch (state)
-		{
-		case JSON_OBJECT_START:
-		case JSON_OBJECT_VAL:
-			json__object_set(sp->u.obj, key, val, 0);
-			state = JSON_OBJECT_NEXT;
-			key = NULL;
-			break;
+	memcpy(key, str, len);
+	key[len] = 0;
+	JSON__KEY(key)->hash = hash;
+	JSON__KEY(key)->len = (int)len;
+	return key;
+}
 
-		case JSON_ARRAY_START:
-		case JSON_ARRAY_VAL:
-			json_array_push(*sp, val);
-			state = JSON_ARRAY_NEXT;
-			break;
+/*	Length of a key of object, keys may contain NUL characters unless they are borrowed.  */
+static size_t json__key_len(const json__object_t* object, const char* key)
+{
+	if (object->flags & JSON__BORROWED_KEYS)
+		return strlen(key);
 
-		case JSON_START:
-			*sp = val;
-			state = val.type == JSON_OBJECT ? JSON_OBJECT_START : JSON_ARRAY_START;
-			continue;
-		}
+	return (size_t)JSON__KEY(key)->len;
+}
 
-		if (flags)
-		{
-			*(++sp) = val;
-			state = val.type == JSON_OBJECT ? JSON_OBJECT_START : JSON_ARRAY_START;
-		}
-	}
+/*	Keys from an arena are released with the arena.  */
+static void json__key_release(json_arena_t* arena, const char* key)
+{
+	if (arena == NULL && --JSON__KEY(key)->refs == 0)
+		free(JSON__KEY(key));
+}
 
-end:
-	/*	end of function */
+char* json_key_new(const char* key, size_t len)
+{
+	return json__key_new(NULL, key, len, json__key_hash(key, len));
+}
 
-	free((void*)key);
-	return *stack;
+void json_key_free(char* key)
+{
+	if (key)
+		json__key_release(NULL, key);
 }
 
 /**************************************************************************************************
-	Json Dump  */
+	JSON Value  */
+
+/*	Access to the fields of json_t, the same code works with both representations  */
+
+/*	Upper 16 bits of boxed values. A value below JSON__BOX_TAG is a double, NaN is stored as the
+	positive quiet NaN so it never collides with a tag. Objects, arrays, strings and integers are
+	tagged with JSON__BOX_TAG + type, true, false, null and none store their type in the payload.
+	Snapshots box their values the same way in both representations.  */
+#define JSON__BOX_TAG 0xFFF9
+#define JSON__BOX_CONST (JSON__BOX_TAG + JSON_TRUE)
+#define JSON__BOX_PAYLOAD JSON__U64(0xFFFF, 0xFFFFFFFF)
+#define JSON__BOX_NAN JSON__U64(0x7FF80000, 0)
 
-static void json_dump_recursive(json_t dst_string, json_t root, int indent)
+static int json__box_type(json_uint64_t bits)
 {
-	int i, x;
-	switch (root.type)
-	{
-	case JSON_OBJECT:
-		json_string_append(dst_string, "{\n", 2);
+	unsigned int tag = (unsigned int)(bits >> 48);
 
-		for (i = 0; i < root.u.obj->len; i++)
-		{
-			int next_indent = indent + 1;
-			json_bucket_t* bucket = (json_bucket_t*)root.u.obj->buckets + i;
+	if (tag < JSON__BOX_TAG)
+		return JSON_NUMBER;
 
-			for (x = 0; x < next_indent; x++)
-				json_string_append(dst_string, "\t", 1);
+	if (tag == JSON__BOX_CONST)
+		return (int)(bits & 0xFF);
 
-			json_string_append(dst_string, "\"", 1);
-			json_string_append(dst_string, bucket->key, (int)strlen(bucket->key));
-			json_string_append(dst_string, "\": ", 3);
-			json_dump_recursive(dst_string, bucket->val, next_indent);
+	return (int)(tag - JSON__BOX_TAG);
+}
 
-			if (i != root.u.obj->len - 1)
-				json_string_append(dst_string, ",", 1);
+static double json__box_number(json_uint64_t bits)
+{
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
 
-			json_string_append(dst_string, "\n", 1);
-		}
+#if defined(JSON_NAN_BOXING)
 
-		for (x = 0; x < indent; x++)
-			json_string_append(dst_string, "\t", 1);
+/*	Integers beyond the double range are stored in a cell of their own. Like containers the cell
+	remembers the arena it was allocated from.  */
+typedef struct json__integer_t
+{
+	json_uint64_t bits;
+	int num_type;
+	json_arena_t* arena;
+
+} json__integer_t;
+
+#define JSON__TYPE(value) json__box_type((value).bits)
+#define JSON__PTR(value) ((void*)(size_t)((value).bits & JSON__BOX_PAYLOAD))
+#define JSON__OBJ(value) ((json__object_t*)JSON__PTR(value))
+#define JSON__ARR(value) ((json__array_t*)JSON__PTR(value))
+#define JSON__STR(value) ((json__string_t*)JSON__PTR(value))
+#define JSON__CELL(value) ((json__integer_t*)JSON__PTR(value))
+#define JSON__NUM(value) json__box_number((value).bits)
+#define JSON__NUM_TYPE(value) ((value).bits >> 48 == JSON__BOX_TAG + JSON_NUMBER \
+	? JSON__CELL(value)->num_type : JSON_NUMBER_REAL)
+#define JSON__INT(value) ((json_int64_t)JSON__CELL(value)->bits)
+#define JSON__UINT(value) (JSON__CELL(value)->bits)
+
+static json_t json__node(int type, void* ptr)
+{
+	json_t node;
 
-		json_string_append(dst_string, "}", 1);
-		break;
+	assert(((json_uint64_t)(size_t)ptr >> 48) == 0);
 
-	case JSON_ARRAY:
-		json_string_append(dst_string, "[\n", 2);
+	node.bits = ((json_uint64_t)(JSON__BOX_TAG + type) << 48) | (json_uint64_t)(size_t)ptr;
+	return node;
+}
 
-		for (i = 0; i < root.u.arr->len; i++)
-		{
-			int next_indent = indent + 1;
-			json_t* node = (json_t*)root.u.arr->data + i;
+static json_t json__const_node(int type)
+{
+	json_t node;
+	node.bits = ((json_uint64_t)JSON__BOX_CONST << 48) | (json_uint64_t)type;
+	return node;
+}
 
-			for (x = 0; x < next_indent; x++)
-				json_string_append(dst_string, "\t", 1);
+static json_t json__integer_node(json_arena_t* arena, int num_type, json_uint64_t bits)
+{
+	json__integer_t* cell = json__alloc(arena, sizeof(json__integer_t));
 
-			json_dump_recursive(dst_string, *node, next_indent);
+	if (cell == NULL)
+		return json__const_node(JSON_NONE);
 
-			if (i < root.u.arr->len - 1)
-				json_string_append(dst_string, ",", 1);
+	cell->bits = bits;
+	cell->num_type = num_type;
+	cell->arena = arena;
+	return json__node(JSON_NUMBER, cell);
+}
 
-			json_string_append(dst_string, "\n", 1);
-		}
+json_t json_number(double value)
+{
+	json_t node;
 
-		for (x = 0; x < indent; x++)
-			json_string_append(dst_string, "\t", 1);
+	if (value != value)
+		node.bits = JSON__BOX_NAN;
+	else
+		memcpy(&node.bits, &value, sizeof(value));
 
-		json_string_append(dst_string, "]", 1);
-		break;
+	return node;
+}
 
-	case JSON_STRING:
-		json_string_append(dst_string, root.u.str->data, root.u.str->len);
-		break;
+#else
 
-	case JSON_NUMBER:
-		json__string_reserve(dst_string.u.str, dst_string.u.str->len + 0x20);
-		dst_string.u.str->len += json_dtoa(root.u.num, 12, dst_string.u.str->data +
-			dst_string.u.str->len, dst_string.u.str->cap - dst_string.u.str->len);
-		break;
+#define JSON__TYPE(value) ((value).type)
+#define JSON__OBJ(value) ((value).u.obj)
+#define JSON__ARR(value) ((value).u.arr)
+#define JSON__STR(value) ((value).u.str)
+#define JSON__NUM(value) ((value).u.num)
+#define JSON__NUM_TYPE(value) ((value).num_type)
+#define JSON__INT(value) ((value).u.i)
+#define JSON__UINT(value) ((value).u.u)
 
-	case JSON_TRUE:
-		json_string_append(dst_string, "true", 4);
-		break;
+static json_t json__node(int type, void* ptr)
+{
+	json_t node;
+	node.type = type;
+	node.num_type = JSON_NUMBER_REAL;
 
-	case JSON_FALSE:
-		json_string_append(dst_string, "false", 5);
-		break;
+	if (type == JSON_OBJECT)
+		JSON__OBJ(node) = ptr;
+	else if (type == JSON_ARRAY)
+		JSON__ARR(node) = ptr;
+	else
+		JSON__STR(node) = ptr;
 
-	case JSON_NULL:
-		json_string_append(dst_string, "null", 4);
-		break;
-	}
+	return node;
 }
 
-/*	Dump JSON value to string.  */
-json_t json_dump(json_t value)
+static json_t json__const_node(int type)
 {
-	json_t string = json_string("");
-
-	if (string.type == JSON_NONE)
-		return string;
-
-	json_dump_recursive(string, value, 0);
-	return string;
+	json_t node;
+	node.type = type;
+	node.num_type = JSON_NUMBER_REAL;
+	node.u.u = 0;
+	return node;
 }
 
-/**************************************************************************************************
-	JSON Object  */
+static json_t json__integer_node(json_arena_t* arena, int num_type, json_uint64_t bits)
+{
+	json_t node;
+	(void)arena;
+	node.type = JSON_NUMBER;
+	node.num_type = num_type;
+	node.u.u = bits;
+	return node;
+}
 
-static int json__object_cmp(const char* a, const char* b)
+json_t json_number(double value)
 {
-	return strcmp(a, b);
+	json_t node;
+	node.type = JSON_NUMBER;
+	node.num_type = JSON_NUMBER_REAL;
+	node.u.num = value;
+	return node;
 }
 
-static int json__object_hash(const char* key)
+#endif
+
+static json_t json__object_node(json_arena_t* arena)
 {
-	int multiplier = 31;
-	int i, m, hash = 0;
+	json__object_t* object = json__alloc(arena, sizeof(json__object_t));
 
-	for (i = 0, m = 1; key[i] != 0; m *= multiplier, i++)
-		hash += key[i] * m;
+	if (object == NULL)
+		return json__const_node(JSON_NONE);
 
-	return hash;
+	*object = json__object_make(arena, 0);
+	return json__node(JSON_OBJECT, object);
 }
 
-json__object_t json__object_new(int len)
+static json_t json__array_node(json_arena_t* arena)
 {
-	json__object_t object;
-	int cap = json__next_capacity(len);
+	json__array_t* array = json__alloc(arena, sizeof(json__array_t));
+
+	if (array == NULL)
+		return json__const_node(JSON_NONE);
+
+	*array = json__array_make(arena, 0);
+	return json__node(JSON_ARRAY, array);
+}
+
+json_t json_object()
+{
+	return json__object_node(NULL);
+}
+
+json_t json_array()
+{
+	return json__array_node(NULL);
+}
+
+json_t json_string(const char* string)
+{
+	size_t len = strlen(string);
+	json__string_t* data_string = json__string_alloc(NULL, len);
+
+	if (!data_string)
+		return json__const_node(JSON_NONE);
+
+	memcpy(data_string->data, string, len + 1);
+	data_string->len = (int)len;
+	return json__node(JSON_STRING, data_string);
+}
+
+json_t json_integer(json_int64_t value)
+{
+	return json__integer_node(NULL, JSON_NUMBER_INT, (json_uint64_t)value);
+}
+
+json_t json_uinteger(json_uint64_t value)
+{
+	return json__integer_node(NULL, JSON_NUMBER_UINT, value);
+}
+
+int json_type(json_t value)
+{
+	return JSON__TYPE(value);
+}
+
+int json_number_type(json_t number)
+{
+	assert(JSON__TYPE(number) == JSON_NUMBER);
+	return JSON__NUM_TYPE(number);
+}
+
+double json_number_value(json_t number)
+{
+	assert(JSON__TYPE(number) == JSON_NUMBER);
+
+	switch (JSON__NUM_TYPE(number))
+	{
+	case JSON_NUMBER_INT:
+		return (double)JSON__INT(number);
+	case JSON_NUMBER_UINT:
+		return (double)JSON__UINT(number);
+	}
+
+	return JSON__NUM(number);
+}
+
+json_int64_t json_integer_value(json_t number)
+{
+	assert(JSON__TYPE(number) == JSON_NUMBER);
+
+	switch (JSON__NUM_TYPE(number))
+	{
+	case JSON_NUMBER_INT:
+		return JSON__INT(number);
+	case JSON_NUMBER_UINT:
+		return (json_int64_t)JSON__UINT(number);
+	}
+
+	return (json_int64_t)JSON__NUM(number);
+}
+
+json_uint64_t json_uinteger_value(json_t number)
+{
+	assert(JSON__TYPE(number) == JSON_NUMBER);
+
+	switch (JSON__NUM_TYPE(number))
+	{
+	case JSON_NUMBER_INT:
+		return (json_uint64_t)JSON__INT(number);
+	case JSON_NUMBER_UINT:
+		return JSON__UINT(number);
+	}
+
+	return (json_uint64_t)JSON__NUM(number);
+}
+
+json_t json_bool(int value)
+{
+	return json__const_node(value ? JSON_TRUE : JSON_FALSE);
+}
+
+json_t json_null()
+{
+	return json__const_node(JSON_NULL);
+}
+
+void json_free(json_t value)
+{
+	int i;
+	switch (JSON__TYPE(value))
+	{
+	case JSON_OBJECT:
+	{
+		json__object_t* object = JSON__OBJ(value);
+
+		/* arena trees are released by the arena */
+		if (object->arena)
+			break;
+
+		for (i = 0; i < object->len; i++)
+		{
+			json_bucket_t* bucket = object->buckets + i;
+			json_free(bucket->val);
+
+			if (!(object->flags & JSON__BORROWED_KEYS))
+				json__key_release(NULL, bucket->key);
+		}
+
+		json__object_free(object);
+		free(object);
+		break;
+	}
+	case JSON_ARRAY:
+	{
+		json__array_t* array = JSON__ARR(value);
+
+		if (array->arena)
+			break;
+
+		for (i = 0; i < array->len; i++)
+		{
+			json_free(array->data[i]);
+		}
+
+		json__array_free(array);
+		free(array);
+		break;
+	}
+	case JSON_STRING:
+		if (JSON__STR(value)->arena)
+			break;
+
+		json__string_free(JSON__STR(value));
+		free(JSON__STR(value));
+		break;
+#if defined(JSON_NAN_BOXING)
+	case JSON_NUMBER:
+		if (JSON__NUM_TYPE(value) != JSON_NUMBER_REAL && JSON__CELL(value)->arena == NULL)
+			free(JSON__CELL(value));
+
+		break;
+#endif
+	}
+}
+
+/**************************************************************************************************
+	JSON Index  */
+
+/*	Stage one of the parser. The input is classified in blocks of 64 bytes into bit masks, one bit
+	per byte. String contents are then masked out using the quote and backslash masks and what
+	remains is the offset of every structural character and the first byte of every scalar. Stage
+	two walks these offsets instead of the raw bytes.  */
+
+#if !defined(JSON_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define JSON__SSE2
+#include <emmintrin.h>
+#if (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) || defined(_MSC_VER)
+#define JSON__AVX2
+#include <immintrin.h>
+#endif
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/*	Input window of stage one. The window only grows if a single token does not fit into it.  */
+#define JSON__WINDOW 0x10000
+
+enum json__class
+{
+	JSON__CLASS_WS = 1 << 0,
+	JSON__CLASS_OP = 1 << 1,
+	JSON__CLASS_QUOTE = 1 << 2,
+	JSON__CLASS_BS = 1 << 3,
+};
+
+/*	Character classes of 64 input bytes  */
+typedef struct json__block_t
+{
+	json_uint64_t ws;
+	json_uint64_t op;
+	json_uint64_t quote;
+	json_uint64_t bs;
+
+} json__block_t;
+
+/*	State carried from one block to the next  */
+typedef struct json__scanner_t
+{
+	json_uint64_t escaped;
+	json_uint64_t in_string;
+	json_uint64_t scalar;
+
+} json__scanner_t;
+
+/*	Map any character to its class bits.  */
+static unsigned char json__class[256];
+
+static int json__ctz(json_uint64_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long result;
+	_BitScanForward64(&result, value);
+	return (int)result;
+#else
+	static const unsigned char debruijn[32] = {
+		0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+		31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+	};
+	unsigned long low = (unsigned long)(value & 0xFFFFFFFF);
+	int result = 0;
+
+	if (low == 0)
+	{
+		low = (unsigned long)(value >> 32);
+		result = 32;
+	}
+
+	return result + debruijn[(((low & (0 - low)) * 0x077CB531UL) & 0xFFFFFFFF) >> 27];
+#endif
+}
+
+static json_uint64_t json__prefix_xor(json_uint64_t bits)
+{
+	bits ^= bits << 1;
+	bits ^= bits << 2;
+	bits ^= bits << 4;
+	bits ^= bits << 8;
+	bits ^= bits << 16;
+	bits ^= bits << 32;
+	return bits;
+}
+
+static void json__classify_scalar(const unsigned char* p, json__block_t* block)
+{
+	int i;
+
+	block->ws = 0;
+	block->op = 0;
+	block->quote = 0;
+	block->bs = 0;
+
+	for (i = 0; i < 64; i++)
+	{
+		json_uint64_t cls = json__class[p[i]];
+
+		block->ws |= (cls & 1) << i;
+		block->op |= ((cls >> 1) & 1) << i;
+		block->quote |= ((cls >> 2) & 1) << i;
+		block->bs |= ((cls >> 3) & 1) << i;
+	}
+}
+
+#if defined(JSON__SSE2)
+static void json__classify_sse2(const unsigned char* p, json__block_t* block)
+{
+	int i;
+
+	block->ws = 0;
+	block->op = 0;
+	block->quote = 0;
+	block->bs = 0;
+
+	for (i = 0; i < 64; i += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+
+		/* '[' and '{', ']' and '}' only differ in bit 0x20 */
+		__m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+
+		__m128i ws = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t'))),
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+
+		__m128i op = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{')), _mm_cmpeq_epi8(lower, _mm_set1_epi8('}'))),
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')), _mm_cmpeq_epi8(v, _mm_set1_epi8(','))));
+
+		block->ws |= (json_uint64_t)(unsigned int)_mm_movemask_epi8(ws) << i;
+		block->op |= (json_uint64_t)(unsigned int)_mm_movemask_epi8(op) << i;
+		block->quote |= (json_uint64_t)(unsigned int)
+			_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('"'))) << i;
+		block->bs |= (json_uint64_t)(unsigned int)
+			_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))) << i;
+	}
+}
+#endif
+
+#if defined(JSON__AVX2)
+#if defined(__GNUC__)
+__attribute__((target("avx2")))
+#endif
+static void json__classify_avx2(const unsigned char* p, json__block_t* block)
+{
+	int i;
+
+	block->ws = 0;
+	block->op = 0;
+	block->quote = 0;
+	block->bs = 0;
+
+	for (i = 0; i < 64; i += 32)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+		__m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+
+		__m256i ws = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t'))),
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))));
+
+		__m256i op = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{')),
+				_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}'))),
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')),
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8(','))));
+
+		block->ws |= (json_uint64_t)(unsigned int)_mm256_movemask_epi8(ws) << i;
+		block->op |= (json_uint64_t)(unsigned int)_mm256_movemask_epi8(op) << i;
+		block->quote |= (json_uint64_t)(unsigned int)
+			_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'))) << i;
+		block->bs |= (json_uint64_t)(unsigned int)
+			_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))) << i;
+	}
+}
+
+static int json__has_avx2()
+{
+#if defined(__GNUC__)
+	return __builtin_cpu_supports("avx2");
+#else
+	int info[4];
+
+	__cpuid(info, 1);
+
+	/* OSXSAVE and AVX, then check the OS saves the YMM registers */
+	if ((info[2] & 0x18000000) != 0x18000000 || (_xgetbv(0) & 6) != 6)
+		return 0;
+
+	__cpuidex(info, 7, 0);
+	return (info[1] & 0x20) != 0;
+#endif
+}
+#endif
+
+/*	Classifier picked at runtime by 'json__tables()'.  */
+static void (*json__classify)(const unsigned char* p, json__block_t* block) = json__classify_scalar;
+
+static int json__index_block(json__scanner_t* s, const json__block_t* block, unsigned int base,
+	unsigned int* out, int n)
+{
+	json_uint64_t even = ((json_uint64_t)0x55555555 << 32) | 0x55555555;
+	json_uint64_t bs = block->bs, escaped = 0, quote, scalar, follows, starts;
+
+	/* Characters escaped by a backslash. Runs of backslashes escape every second character, runs
+	   starting on an odd bit are found through the carry of an addition. */
+
+	if (bs | s->escaped)
+	{
+		json_uint64_t follows_escape, odd_starts, even_starts;
+
+		bs &= ~s->escaped;
+		follows_escape = (bs << 1) | s->escaped;
+		odd_starts = bs & ~even & ~follows_escape;
+		even_starts = odd_starts + bs;
+		s->escaped = even_starts < bs;
+		escaped = (even ^ (even_starts << 1)) & follows_escape;
+	}
+
+	/* Everything from an opening quote to (excluding) the closing quote */
+
+	quote = block->quote & ~escaped;
+	s->in_string ^= json__prefix_xor(quote);
+
+	/* A token starts at every structural character and at every scalar not directly following
+	   another scalar, except within strings */
+
+	scalar = ~(block->op | block->ws);
+	follows = ((scalar & ~quote) << 1) | s->scalar;
+	s->scalar = (scalar & ~quote) >> 63;
+	starts = (block->op | (scalar & ~follows)) & ~(s->in_string ^ quote);
+	s->in_string = 0 - (s->in_string >> 63);
+
+	while (starts)
+	{
+		out[n++] = base + (unsigned int)json__ctz(starts);
+		starts &= starts - 1;
+	}
+
+	return n;
+}
+
+/*	Write the offset of every token in text to out. Returns the number of tokens.  */
+static int json__index(const char* text, size_t len, unsigned int* out)
+{
+	json__scanner_t s = { 0, 0, 0 };
+	json__block_t block;
+	unsigned char tail[64];
+	size_t i;
+	int n = 0;
+
+	for (i = 0; i + 64 <= len; i += 64)
+	{
+		json__classify((const unsigned char*)text + i, &block);
+		n = json__index_block(&s, &block, (unsigned int)i, out, n);
+	}
+
+	/* The last block is padded with whitespace, nothing past len is read */
+
+	if (i < len)
+	{
+		memset(tail, ' ', 64);
+		memcpy(tail, text + i, len - i);
+		json__classify(tail, &block);
+		n = json__index_block(&s, &block, (unsigned int)i, out, n);
+	}
+
+	return n;
+}
+
+/**************************************************************************************************
+	JSON Escape  */
+
+/*	Strings are decoded and encoded in runs. The scanners return the first byte that needs
+	attention, a quote, a backslash or a control character, or end. The SIMD versions test 16 or
+	32 bytes at a time and never read past end.  */
+
+static const char* json__escape_scalar(const char* c, const char* end)
+{
+	while (c != end && (unsigned char)*c >= 0x20 && *c != '"' && *c != '\\')
+		c++;
+
+	return c;
+}
+
+#if defined(JSON__SSE2)
+static const char* json__escape_sse2(const char* c, const char* end)
+{
+	const __m128i quote = _mm_set1_epi8('"');
+	const __m128i bs = _mm_set1_epi8('\\');
+	const __m128i ctrl = _mm_set1_epi8(0x1F);
+
+	for (; end - c >= 16; c += 16)
+	{
+		__m128i v = _mm_loadu_si128((const __m128i*)c);
+
+		/* unsigned v <= 0x1F */
+		__m128i special = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bs)),
+			_mm_cmpeq_epi8(_mm_max_epu8(v, ctrl), ctrl));
+
+		int mask = _mm_movemask_epi8(special);
+
+		if (mask)
+			return c + json__ctz((json_uint64_t)(unsigned int)mask);
+	}
+
+	return json__escape_scalar(c, end);
+}
+#endif
+
+#if defined(JSON__AVX2)
+#if defined(__GNUC__)
+__attribute__((target("avx2")))
+#endif
+static const char* json__escape_avx2(const char* c, const char* end)
+{
+	const __m256i quote = _mm256_set1_epi8('"');
+	const __m256i bs = _mm256_set1_epi8('\\');
+	const __m256i ctrl = _mm256_set1_epi8(0x1F);
+
+	for (; end - c >= 32; c += 32)
+	{
+		__m256i v = _mm256_loadu_si256((const __m256i*)c);
+
+		__m256i special = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, quote), _mm256_cmpeq_epi8(v, bs)),
+			_mm256_cmpeq_epi8(_mm256_max_epu8(v, ctrl), ctrl));
+
+		int mask = _mm256_movemask_epi8(special);
+
+		if (mask)
+			return c + json__ctz((json_uint64_t)(unsigned int)mask);
+	}
+
+	return json__escape_sse2(c, end);
+}
+#endif
+
+/*	Scanner picked at runtime by 'json__tables()'.  */
+#if defined(JSON__SSE2)
+static const char* (*json__escape_scan)(const char* c, const char* end) = json__escape_sse2;
+#else
+static const char* (*json__escape_scan)(const char* c, const char* end) = json__escape_scalar;
+#endif
+
+/**************************************************************************************************
+	JSON Number  */
+
+/*	Numbers are scanned by hand instead of strtod, which is slow, depends on the locale and rounds
+	every integer to a double. Integers that fit 64 bits are returned exactly. Decimals are
+	converted with Clinger's fast path if mantissa and exponent are small and with the
+	Eisel-Lemire algorithm otherwise. The rare inputs neither can round correctly fall back to
+	strtod.  */
+
+enum json__number_result
+{
+	JSON__NUMBER_INVALID = -1,
+	JSON__NUMBER_REAL,
+	JSON__NUMBER_INT,
+	JSON__NUMBER_UINT,
+};
+
+/*	128 bit approximations (rounded down) of the powers of ten from 1e-348 to 1e347, low and high
+	64 bits.  */
+static const json_uint64_t json__pow10_128[][2] = {
+	{ JSON__U64(0x1732C869, 0xCD60E453), JSON__U64(0xFA8FD5A0, 0x081C0288) },
+	{ JSON__U64(0x0E7FBD42, 0x205C8EB4), JSON__U64(0x9C99E584, 0x05118195) },
+	{ JSON__U64(0x521FAC92, 0xA873B261), JSON__U64(0xC3C05EE5, 0x0655E1FA) },
+	{ JSON__U64(0xE6A797B7, 0x52909EF9), JSON__U64(0xF4B0769E, 0x47EB5A78) },
+	{ JSON__U64(0x9028BED2, 0x939A635C), JSON__U64(0x98EE4A22, 0xECF3188B) },
+	{ JSON__U64(0x7432EE87, 0x3880FC33), JSON__U64(0xBF29DCAB, 0xA82FDEAE) },
+	{ JSON__U64(0x113FAA29, 0x06A13B3F), JSON__U64(0xEEF453D6, 0x923BD65A) },
+	{ JSON__U64(0x4AC7CA59, 0xA424C507), JSON__U64(0x9558B466, 0x1B6565F8) },
+	{ JSON__U64(0x5D79BCF0, 0x0D2DF649), JSON__U64(0xBAAEE17F, 0xA23EBF76) },
+	{ JSON__U64(0xF4D82C2C, 0x107973DC), JSON__U64(0xE95A99DF, 0x8ACE6F53) },
+	{ JSON__U64(0x79071B9B, 0x8A4BE869), JSON__U64(0x91D8A02B, 0xB6C10594) },
+	{ JSON__U64(0x9748E282, 0x6CDEE284), JSON__U64(0xB64EC836, 0xA47146F9) },
+	{ JSON__U64(0xFD1B1B23, 0x08169B25), JSON__U64(0xE3E27A44, 0x4D8D98B7) },
+	{ JSON__U64(0xFE30F0F5, 0xE50E20F7), JSON__U64(0x8E6D8C6A, 0xB0787F72) },
+	{ JSON__U64(0xBDBD2D33, 0x5E51A935), JSON__U64(0xB208EF85, 0x5C969F4F) },
+	{ JSON__U64(0xAD2C7880, 0x35E61382), JSON__U64(0xDE8B2B66, 0xB3BC4723) },
+	{ JSON__U64(0x4C3BCB50, 0x21AFCC31), JSON__U64(0x8B16FB20, 0x3055AC76) },
+	{ JSON__U64(0xDF4ABE24, 0x2A1BBF3D), JSON__U64(0xADDCB9E8, 0x3C6B1793) },
+	{ JSON__U64(0xD71D6DAD, 0x34A2AF0D), JSON__U64(0xD953E862, 0x4B85DD78) },
+	{ JSON__U64(0x8672648C, 0x40E5AD68), JSON__U64(0x87D4713D, 0x6F33AA6B) },
+	{ JSON__U64(0x680EFDAF, 0x511F18C2), JSON__U64(0xA9C98D8C, 0xCB009506) },
+	{ JSON__U64(0x0212BD1B, 0x2566DEF2), JSON__U64(0xD43BF0EF, 0xFDC0BA48) },
+	{ JSON__U64(0x014BB630, 0xF7604B57), JSON__U64(0x84A57695, 0xFE98746D) },
+	{ JSON__U64(0x419EA3BD, 0x35385E2D), JSON__U64(0xA5CED43B, 0x7E3E9188) },
+	{ JSON__U64(0x52064CAC, 0x828675B9), JSON__U64(0xCF42894A, 0x5DCE35EA) },
+	{ JSON__U64(0x7343EFEB, 0xD1940993), JSON__U64(0x818995CE, 0x7AA0E1B2) },
+	{ JSON__U64(0x1014EBE6, 0xC5F90BF8), JSON__U64(0xA1EBFB42, 0x19491A1F) },
+	{ JSON__U64(0xD41A26E0, 0x77774EF6), JSON__U64(0xCA66FA12, 0x9F9B60A6) },
+	{ JSON__U64(0x8920B098, 0x955522B4), JSON__U64(0xFD00B897, 0x478238D0) },
+	{ JSON__U64(0x55B46E5F, 0x5D5535B0), JSON__U64(0x9E20735E, 0x8CB16382) },
+	{ JSON__U64(0xEB2189F7, 0x34AA831D), JSON__U64(0xC5A89036, 0x2FDDBC62) },
+	{ JSON__U64(0xA5E9EC75, 0x01D523E4), JSON__U64(0xF712B443, 0xBBD52B7B) },
+	{ JSON__U64(0x47B233C9, 0x2125366E), JSON__U64(0x9A6BB0AA, 0x55653B2D) },
+	{ JSON__U64(0x999EC0BB, 0x696E840A), JSON__U64(0xC1069CD4, 0xEABE89F8) },
+	{ JSON__U64(0xC00670EA, 0x43CA250D), JSON__U64(0xF148440A, 0x256E2C76) },
+	{ JSON__U64(0x38040692, 0x6A5E5728), JSON__U64(0x96CD2A86, 0x5764DBCA) },
+	{ JSON__U64(0xC6050837, 0x04F5ECF2), JSON__U64(0xBC807527, 0xED3E12BC) },
+	{ JSON__U64(0xF7864A44, 0xC633682E), JSON__U64(0xEBA09271, 0xE88D976B) },
+	{ JSON__U64(0x7AB3EE6A, 0xFBE0211D), JSON__U64(0x93445B87, 0x31587EA3) },
+	{ JSON__U64(0x5960EA05, 0xBAD82964), JSON__U64(0xB8157268, 0xFDAE9E4C) },
+	{ JSON__U64(0x6FB92487, 0x298E33BD), JSON__U64(0xE61ACF03, 0x3D1A45DF) },
+	{ JSON__U64(0xA5D3B6D4, 0x79F8E056), JSON__U64(0x8FD0C162, 0x06306BAB) },
+	{ JSON__U64(0x8F48A489, 0x9877186C), JSON__U64(0xB3C4F1BA, 0x87BC8696) },
+	{ JSON__U64(0x331ACDAB, 0xFE94DE87), JSON__U64(0xE0B62E29, 0x29ABA83C) },
+	{ JSON__U64(0x9FF0C08B, 0x7F1D0B14), JSON__U64(0x8C71DCD9, 0xBA0B4925) },
+	{ JSON__U64(0x07ECF0AE, 0x5EE44DD9), JSON__U64(0xAF8E5410, 0x288E1B6F) },
+	{ JSON__U64(0xC9E82CD9, 0xF69D6150), JSON__U64(0xDB71E914, 0x32B1A24A) },
+	{ JSON__U64(0xBE311C08, 0x3A225CD2), JSON__U64(0x892731AC, 0x9FAF056E) },
+	{ JSON__U64(0x6DBD630A, 0x48AAF406), JSON__U64(0xAB70FE17, 0xC79AC6CA) },
+	{ JSON__U64(0x092CBBCC, 0xDAD5B108), JSON__U64(0xD64D3D9D, 0xB981787D) },
+	{ JSON__U64(0x25BBF560, 0x08C58EA5), JSON__U64(0x85F04682, 0x93F0EB4E) },
+	{ JSON__U64(0xAF2AF2B8, 0x0AF6F24E), JSON__U64(0xA76C5823, 0x38ED2621) },
+	{ JSON__U64(0x1AF5AF66, 0x0DB4AEE1), JSON__U64(0xD1476E2C, 0x07286FAA) },
+	{ JSON__U64(0x50D98D9F, 0xC890ED4D), JSON__U64(0x82CCA4DB, 0x847945CA) },
+	{ JSON__U64(0xE50FF107, 0xBAB528A0), JSON__U64(0xA37FCE12, 0x6597973C) },
+	{ JSON__U64(0x1E53ED49, 0xA96272C8), JSON__U64(0xCC5FC196, 0xFEFD7D0C) },
+	{ JSON__U64(0x25E8E89C, 0x13BB0F7A), JSON__U64(0xFF77B1FC, 0xBEBCDC4F) },
+	{ JSON__U64(0x77B19161, 0x8C54E9AC), JSON__U64(0x9FAACF3D, 0xF73609B1) },
+	{ JSON__U64(0xD59DF5B9, 0xEF6A2417), JSON__U64(0xC795830D, 0x75038C1D) },
+	{ JSON__U64(0x4B057328, 0x6B44AD1D), JSON__U64(0xF97AE3D0, 0xD2446F25) },
+	{ JSON__U64(0x4EE367F9, 0x430AEC32), JSON__U64(0x9BECCE62, 0x836AC577) },
+	{ JSON__U64(0x229C41F7, 0x93CDA73F), JSON__U64(0xC2E801FB, 0x244576D5) },
+	{ JSON__U64(0x6B435275, 0x78C1110F), JSON__U64(0xF3A20279, 0xED56D48A) },
+	{ JSON__U64(0x830A1389, 0x6B78AAA9), JSON__U64(0x9845418C, 0x345644D6) },
+	{ JSON__U64(0x23CC986B, 0xC656D553), JSON__U64(0xBE5691EF, 0x416BD60C) },
+	{ JSON__U64(0x2CBFBE86, 0xB7EC8AA8), JSON__U64(0xEDEC366B, 0x11C6CB8F) },
+	{ JSON__U64(0x7BF7D714, 0x32F3D6A9), JSON__U64(0x94B3A202, 0xEB1C3F39) },
+	{ JSON__U64(0xDAF5CCD9, 0x3FB0CC53), JSON__U64(0xB9E08A83, 0xA5E34F07) },
+	{ JSON__U64(0xD1B3400F, 0x8F9CFF68), JSON__U64(0xE858AD24, 0x8F5C22C9) },
+	{ JSON__U64(0x23100809, 0xB9C21FA1), JSON__U64(0x91376C36, 0xD99995BE) },
+	{ JSON__U64(0xABD40A0C, 0x2832A78A), JSON__U64(0xB5854744, 0x8FFFFB2D) },
+	{ JSON__U64(0x16C90C8F, 0x323F516C), JSON__U64(0xE2E69915, 0xB3FFF9F9) },
+	{ JSON__U64(0xAE3DA7D9, 0x7F6792E3), JSON__U64(0x8DD01FAD, 0x907FFC3B) },
+	{ JSON__U64(0x99CD11CF, 0xDF41779C), JSON__U64(0xB1442798, 0xF49FFB4A) },
+	{ JSON__U64(0x40405643, 0xD711D583), JSON__U64(0xDD95317F, 0x31C7FA1D) },
+	{ JSON__U64(0x482835EA, 0x666B2572), JSON__U64(0x8A7D3EEF, 0x7F1CFC52) },
+	{ JSON__U64(0xDA324365, 0x0005EECF), JSON__U64(0xAD1C8EAB, 0x5EE43B66) },
+	{ JSON__U64(0x90BED43E, 0x40076A82), JSON__U64(0xD863B256, 0x369D4A40) },
+	{ JSON__U64(0x5A7744A6, 0xE804A291), JSON__U64(0x873E4F75, 0xE2224E68) },
+	{ JSON__U64(0x711515D0, 0xA205CB36), JSON__U64(0xA90DE353, 0x5AAAE202) },
+	{ JSON__U64(0x0D5A5B44, 0xCA873E03), JSON__U64(0xD3515C28, 0x31559A83) },
+	{ JSON__U64(0xE858790A, 0xFE9486C2), JSON__U64(0x8412D999, 0x1ED58091) },
+	{ JSON__U64(0x626E974D, 0xBE39A872), JSON__U64(0xA5178FFF, 0x668AE0B6) },
+	{ JSON__U64(0xFB0A3D21, 0x2DC8128F), JSON__U64(0xCE5D73FF, 0x402D98E3) },
+	{ JSON__U64(0x7CE66634, 0xBC9D0B99), JSON__U64(0x80FA687F, 0x881C7F8E) },
+	{ JSON__U64(0x1C1FFFC1, 0xEBC44E80), JSON__U64(0xA139029F, 0x6A239F72) },
+	{ JSON__U64(0xA327FFB2, 0x66B56220), JSON__U64(0xC9874347, 0x44AC874E) },
+	{ JSON__U64(0x4BF1FF9F, 0x0062BAA8), JSON__U64(0xFBE91419, 0x15D7A922) },
+	{ JSON__U64(0x6F773FC3, 0x603DB4A9), JSON__U64(0x9D71AC8F, 0xADA6C9B5) },
+	{ JSON__U64(0xCB550FB4, 0x384D21D3), JSON__U64(0xC4CE17B3, 0x99107C22) },
+	{ JSON__U64(0x7E2A53A1, 0x46606A48), JSON__U64(0xF6019DA0, 0x7F549B2B) },
+	{ JSON__U64(0x2EDA7444, 0xCBFC426D), JSON__U64(0x99C10284, 0x4F94E0FB) },
+	{ JSON__U64(0xFA911155, 0xFEFB5308), JSON__U64(0xC0314325, 0x637A1939) },
+	{ JSON__U64(0x793555AB, 0x7EBA27CA), JSON__U64(0xF03D93EE, 0xBC589F88) },
+	{ JSON__U64(0x4BC1558B, 0x2F3458DE), JSON__U64(0x96267C75, 0x35B763B5) },
+	{ JSON__U64(0x9EB1AAED, 0xFB016F16), JSON__U64(0xBBB01B92, 0x83253CA2) },
+	{ JSON__U64(0x465E15A9, 0x79C1CADC), JSON__U64(0xEA9C2277, 0x23EE8BCB) },
+	{ JSON__U64(0x0BFACD89, 0xEC191EC9), JSON__U64(0x92A1958A, 0x7675175F) },
+	{ JSON__U64(0xCEF980EC, 0x671F667B), JSON__U64(0xB749FAED, 0x14125D36) },
+	{ JSON__U64(0x82B7E127, 0x80E7401A), JSON__U64(0xE51C79A8, 0x5916F484) },
+	{ JSON__U64(0xD1B2ECB8, 0xB0908810), JSON__U64(0x8F31CC09, 0x37AE58D2) },
+	{ JSON__U64(0x861FA7E6, 0xDCB4AA15), JSON__U64(0xB2FE3F0B, 0x8599EF07) },
+	{ JSON__U64(0x67A791E0, 0x93E1D49A), JSON__U64(0xDFBDCECE, 0x67006AC9) },
+	{ JSON__U64(0xE0C8BB2C, 0x5C6D24E0), JSON__U64(0x8BD6A141, 0x006042BD) },
+	{ JSON__U64(0x58FAE9F7, 0x73886E18), JSON__U64(0xAECC4991, 0x4078536D) },
+	{ JSON__U64(0xAF39A475, 0x506A899E), JSON__U64(0xDA7F5BF5, 0x90966848) },
+	{ JSON__U64(0x6D8406C9, 0x52429603), JSON__U64(0x888F9979, 0x7A5E012D) },
+	{ JSON__U64(0xC8E5087B, 0xA6D33B83), JSON__U64(0xAAB37FD7, 0xD8F58178) },
+	{ JSON__U64(0xFB1E4A9A, 0x90880A64), JSON__U64(0xD5605FCD, 0xCF32E1D6) },
+	{ JSON__U64(0x5CF2EEA0, 0x9A55067F), JSON__U64(0x855C3BE0, 0xA17FCD26) },
+	{ JSON__U64(0xF42FAA48, 0xC0EA481E), JSON__U64(0xA6B34AD8, 0xC9DFC06F) },
+	{ JSON__U64(0xF13B94DA, 0xF124DA26), JSON__U64(0xD0601D8E, 0xFC57B08B) },
+	{ JSON__U64(0x76C53D08, 0xD6B70858), JSON__U64(0x823C1279, 0x5DB6CE57) },
+	{ JSON__U64(0x54768C4B, 0x0C64CA6E), JSON__U64(0xA2CB1717, 0xB52481ED) },
+	{ JSON__U64(0xA9942F5D, 0xCF7DFD09), JSON__U64(0xCB7DDCDD, 0xA26DA268) },
+	{ JSON__U64(0xD3F93B35, 0x435D7C4C), JSON__U64(0xFE5D5415, 0x0B090B02) },
+	{ JSON__U64(0xC47BC501, 0x4A1A6DAF), JSON__U64(0x9EFA548D, 0x26E5A6E1) },
+	{ JSON__U64(0x359AB641, 0x9CA1091B), JSON__U64(0xC6B8E9B0, 0x709F109A) },
+	{ JSON__U64(0xC30163D2, 0x03C94B62), JSON__U64(0xF867241C, 0x8CC6D4C0) },
+	{ JSON__U64(0x79E0DE63, 0x425DCF1D), JSON__U64(0x9B407691, 0xD7FC44F8) },
+	{ JSON__U64(0x985915FC, 0x12F542E4), JSON__U64(0xC2109436, 0x4DFB5636) },
+	{ JSON__U64(0x3E6F5B7B, 0x17B2939D), JSON__U64(0xF294B943, 0xE17A2BC4) },
+	{ JSON__U64(0xA705992C, 0xEECF9C42), JSON__U64(0x979CF3CA, 0x6CEC5B5A) },
+	{ JSON__U64(0x50C6FF78, 0x2A838353), JSON__U64(0xBD8430BD, 0x08277231) },
+	{ JSON__U64(0xA4F8BF56, 0x35246428), JSON__U64(0xECE53CEC, 0x4A314EBD) },
+	{ JSON__U64(0x871B7795, 0xE136BE99), JSON__U64(0x940F4613, 0xAE5ED136) },
+	{ JSON__U64(0x28E2557B, 0x59846E3F), JSON__U64(0xB9131798, 0x99F68584) },
+	{ JSON__U64(0x331AEADA, 0x2FE589CF), JSON__U64(0xE757DD7E, 0xC07426E5) },
+	{ JSON__U64(0x3FF0D2C8, 0x5DEF7621), JSON__U64(0x9096EA6F, 0x3848984F) },
+	{ JSON__U64(0x0FED077A, 0x756B53A9), JSON__U64(0xB4BCA50B, 0x065ABE63) },
+	{ JSON__U64(0xD3E84959, 0x12C62894), JSON__U64(0xE1EBCE4D, 0xC7F16DFB) },
+	{ JSON__U64(0x64712DD7, 0xABBBD95C), JSON__U64(0x8D3360F0, 0x9CF6E4BD) },
+	{ JSON__U64(0xBD8D794D, 0x96AACFB3), JSON__U64(0xB080392C, 0xC4349DEC) },
+	{ JSON__U64(0xECF0D7A0, 0xFC5583A0), JSON__U64(0xDCA04777, 0xF541C567) },
+	{ JSON__U64(0xF41686C4, 0x9DB57244), JSON__U64(0x89E42CAA, 0xF9491B60) },
+	{ JSON__U64(0x311C2875, 0xC522CED5), JSON__U64(0xAC5D37D5, 0xB79B6239) },
+	{ JSON__U64(0x7D633293, 0x366B828B), JSON__U64(0xD77485CB, 0x25823AC7) },
+	{ JSON__U64(0xAE5DFF9C, 0x02033197), JSON__U64(0x86A8D39E, 0xF77164BC) },
+	{ JSON__U64(0xD9F57F83, 0x0283FDFC), JSON__U64(0xA8530886, 0xB54DBDEB) },
+	{ JSON__U64(0xD072DF63, 0xC324FD7B), JSON__U64(0xD267CAA8, 0x62A12D66) },
+	{ JSON__U64(0x4247CB9E, 0x59F71E6D), JSON__U64(0x8380DEA9, 0x3DA4BC60) },
+	{ JSON__U64(0x52D9BE85, 0xF074E608), JSON__U64(0xA4611653, 0x8D0DEB78) },
+	{ JSON__U64(0x67902E27, 0x6C921F8B), JSON__U64(0xCD795BE8, 0x70516656) },
+	{ JSON__U64(0x00BA1CD8, 0xA3DB53B6), JSON__U64(0x806BD971, 0x4632DFF6) },
+	{ JSON__U64(0x80E8A40E, 0xCCD228A4), JSON__U64(0xA086CFCD, 0x97BF97F3) },
+	{ JSON__U64(0x6122CD12, 0x8006B2CD), JSON__U64(0xC8A883C0, 0xFDAF7DF0) },
+	{ JSON__U64(0x796B8057, 0x20085F81), JSON__U64(0xFAD2A4B1, 0x3D1B5D6C) },
+	{ JSON__U64(0xCBE33036, 0x74053BB0), JSON__U64(0x9CC3A6EE, 0xC6311A63) },
+	{ JSON__U64(0xBEDBFC44, 0x11068A9C), JSON__U64(0xC3F490AA, 0x77BD60FC) },
+	{ JSON__U64(0xEE92FB55, 0x15482D44), JSON__U64(0xF4F1B4D5, 0x15ACB93B) },
+	{ JSON__U64(0x751BDD15, 0x2D4D1C4A), JSON__U64(0x99171105, 0x2D8BF3C5) },
+	{ JSON__U64(0xD262D45A, 0x78A0635D), JSON__U64(0xBF5CD546, 0x78EEF0B6) },
+	{ JSON__U64(0x86FB8971, 0x16C87C34), JSON__U64(0xEF340A98, 0x172AACE4) },
+	{ JSON__U64(0xD45D35E6, 0xAE3D4DA0), JSON__U64(0x9580869F, 0x0E7AAC0E) },
+	{ JSON__U64(0x89748360, 0x59CCA109), JSON__U64(0xBAE0A846, 0xD2195712) },
+	{ JSON__U64(0x2BD1A438, 0x703FC94B), JSON__U64(0xE998D258, 0x869FACD7) },
+	{ JSON__U64(0x7B6306A3, 0x4627DDCF), JSON__U64(0x91FF8377, 0x5423CC06) },
+	{ JSON__U64(0x1A3BC84C, 0x17B1D542), JSON__U64(0xB67F6455, 0x292CBF08) },
+	{ JSON__U64(0x20CABA5F, 0x1D9E4A93), JSON__U64(0xE41F3D6A, 0x7377EECA) },
+	{ JSON__U64(0x547EB47B, 0x7282EE9C), JSON__U64(0x8E938662, 0x882AF53E) },
+	{ JSON__U64(0xE99E619A, 0x4F23AA43), JSON__U64(0xB23867FB, 0x2A35B28D) },
+	{ JSON__U64(0x6405FA00, 0xE2EC94D4), JSON__U64(0xDEC681F9, 0xF4C31F31) },
+	{ JSON__U64(0xDE83BC40, 0x8DD3DD04), JSON__U64(0x8B3C113C, 0x38F9F37E) },
+	{ JSON__U64(0x9624AB50, 0xB148D445), JSON__U64(0xAE0B158B, 0x4738705E) },
+	{ JSON__U64(0x3BADD624, 0xDD9B0957), JSON__U64(0xD98DDAEE, 0x19068C76) },
+	{ JSON__U64(0xE54CA5D7, 0x0A80E5D6), JSON__U64(0x87F8A8D4, 0xCFA417C9) },
+	{ JSON__U64(0x5E9FCF4C, 0xCD211F4C), JSON__U64(0xA9F6D30A, 0x038D1DBC) },
+	{ JSON__U64(0x7647C320, 0x0069671F), JSON__U64(0xD47487CC, 0x8470652B) },
+	{ JSON__U64(0x29ECD9F4, 0x0041E073), JSON__U64(0x84C8D4DF, 0xD2C63F3B) },
+	{ JSON__U64(0xF4681071, 0x00525890), JSON__U64(0xA5FB0A17, 0xC777CF09) },
+	{ JSON__U64(0x7182148D, 0x4066EEB4), JSON__U64(0xCF79CC9D, 0xB955C2CC) },
+	{ JSON__U64(0xC6F14CD8, 0x48405530), JSON__U64(0x81AC1FE2, 0x93D599BF) },
+	{ JSON__U64(0xB8ADA00E, 0x5A506A7C), JSON__U64(0xA21727DB, 0x38CB002F) },
+	{ JSON__U64(0xA6D90811, 0xF0E4851C), JSON__U64(0xCA9CF1D2, 0x06FDC03B) },
+	{ JSON__U64(0x908F4A16, 0x6D1DA663), JSON__U64(0xFD442E46, 0x88BD304A) },
+	{ JSON__U64(0x9A598E4E, 0x043287FE), JSON__U64(0x9E4A9CEC, 0x15763E2E) },
+	{ JSON__U64(0x40EFF1E1, 0x853F29FD), JSON__U64(0xC5DD4427, 0x1AD3CDBA) },
+	{ JSON__U64(0xD12BEE59, 0xE68EF47C), JSON__U64(0xF7549530, 0xE188C128) },
+	{ JSON__U64(0x82BB74F8, 0x301958CE), JSON__U64(0x9A94DD3E, 0x8CF578B9) },
+	{ JSON__U64(0xE36A5236, 0x3C1FAF01), JSON__U64(0xC13A148E, 0x3032D6E7) },
+	{ JSON__U64(0xDC44E6C3, 0xCB279AC1), JSON__U64(0xF18899B1, 0xBC3F8CA1) },
+	{ JSON__U64(0x29AB103A, 0x5EF8C0B9), JSON__U64(0x96F5600F, 0x15A7B7E5) },
+	{ JSON__U64(0x7415D448, 0xF6B6F0E7), JSON__U64(0xBCB2B812, 0xDB11A5DE) },
+	{ JSON__U64(0x111B495B, 0x3464AD21), JSON__U64(0xEBDF6617, 0x91D60F56) },
+	{ JSON__U64(0xCAB10DD9, 0x00BEEC34), JSON__U64(0x936B9FCE, 0xBB25C995) },
+	{ JSON__U64(0x3D5D514F, 0x40EEA742), JSON__U64(0xB84687C2, 0x69EF3BFB) },
+	{ JSON__U64(0x0CB4A5A3, 0x112A5112), JSON__U64(0xE65829B3, 0x046B0AFA) },
+	{ JSON__U64(0x47F0E785, 0xEABA72AB), JSON__U64(0x8FF71A0F, 0xE2C2E6DC) },
+	{ JSON__U64(0x59ED2167, 0x65690F56), JSON__U64(0xB3F4E093, 0xDB73A093) },
+	{ JSON__U64(0x306869C1, 0x3EC3532C), JSON__U64(0xE0F218B8, 0xD25088B8) },
+	{ JSON__U64(0x1E414218, 0xC73A13FB), JSON__U64(0x8C974F73, 0x83725573) },
+	{ JSON__U64(0xE5D1929E, 0xF90898FA), JSON__U64(0xAFBD2350, 0x644EEACF) },
+	{ JSON__U64(0xDF45F746, 0xB74ABF39), JSON__U64(0xDBAC6C24, 0x7D62A583) },
+	{ JSON__U64(0x6B8BBA8C, 0x328EB783), JSON__U64(0x894BC396, 0xCE5DA772) },
+	{ JSON__U64(0x066EA92F, 0x3F326564), JSON__U64(0xAB9EB47C, 0x81F5114F) },
+	{ JSON__U64(0xC80A537B, 0x0EFEFEBD), JSON__U64(0xD686619B, 0xA27255A2) },
+	{ JSON__U64(0xBD06742C, 0xE95F5F36), JSON__U64(0x8613FD01, 0x45877585) },
+	{ JSON__U64(0x2C481138, 0x23B73704), JSON__U64(0xA798FC41, 0x96E952E7) },
+	{ JSON__U64(0xF75A1586, 0x2CA504C5), JSON__U64(0xD17F3B51, 0xFCA3A7A0) },
+	{ JSON__U64(0x9A984D73, 0xDBE722FB), JSON__U64(0x82EF8513, 0x3DE648C4) },
+	{ JSON__U64(0xC13E60D0, 0xD2E0EBBA), JSON__U64(0xA3AB6658, 0x0D5FDAF5) },
+	{ JSON__U64(0x318DF905, 0x079926A8), JSON__U64(0xCC963FEE, 0x10B7D1B3) },
+	{ JSON__U64(0xFDF17746, 0x497F7052), JSON__U64(0xFFBBCFE9, 0x94E5C61F) },
+	{ JSON__U64(0xFEB6EA8B, 0xEDEFA633), JSON__U64(0x9FD561F1, 0xFD0F9BD3) },
+	{ JSON__U64(0xFE64A52E, 0xE96B8FC0), JSON__U64(0xC7CABA6E, 0x7C5382C8) },
+	{ JSON__U64(0x3DFDCE7A, 0xA3C673B0), JSON__U64(0xF9BD690A, 0x1B68637B) },
+	{ JSON__U64(0x06BEA10C, 0xA65C084E), JSON__U64(0x9C1661A6, 0x51213E2D) },
+	{ JSON__U64(0x486E494F, 0xCFF30A62), JSON__U64(0xC31BFA0F, 0xE5698DB8) },
+	{ JSON__U64(0x5A89DBA3, 0xC3EFCCFA), JSON__U64(0xF3E2F893, 0xDEC3F126) },
+	{ JSON__U64(0xF8962946, 0x5A75E01C), JSON__U64(0x986DDB5C, 0x6B3A76B7) },
+	{ JSON__U64(0xF6BBB397, 0xF1135823), JSON__U64(0xBE895233, 0x86091465) },
+	{ JSON__U64(0x746AA07D, 0xED582E2C), JSON__U64(0xEE2BA6C0, 0x678B597F) },
+	{ JSON__U64(0xA8C2A44E, 0xB4571CDC), JSON__U64(0x94DB4838, 0x40B717EF) },
+	{ JSON__U64(0x92F34D62, 0x616CE413), JSON__U64(0xBA121A46, 0x50E4DDEB) },
+	{ JSON__U64(0x77B020BA, 0xF9C81D17), JSON__U64(0xE896A0D7, 0xE51E1566) },
+	{ JSON__U64(0x0ACE1474, 0xDC1D122E), JSON__U64(0x915E2486, 0xEF32CD60) },
+	{ JSON__U64(0x0D819992, 0x132456BA), JSON__U64(0xB5B5ADA8, 0xAAFF80B8) },
+	{ JSON__U64(0x10E1FFF6, 0x97ED6C69), JSON__U64(0xE3231912, 0xD5BF60E6) },
+	{ JSON__U64(0xCA8D3FFA, 0x1EF463C1), JSON__U64(0x8DF5EFAB, 0xC5979C8F) },
+	{ JSON__U64(0xBD308FF8, 0xA6B17CB2), JSON__U64(0xB1736B96, 0xB6FD83B3) },
+	{ JSON__U64(0xAC7CB3F6, 0xD05DDBDE), JSON__U64(0xDDD0467C, 0x64BCE4A0) },
+	{ JSON__U64(0x6BCDF07A, 0x423AA96B), JSON__U64(0x8AA22C0D, 0xBEF60EE4) },
+	{ JSON__U64(0x86C16C98, 0xD2C953C6), JSON__U64(0xAD4AB711, 0x2EB3929D) },
+	{ JSON__U64(0xE871C7BF, 0x077BA8B7), JSON__U64(0xD89D64D5, 0x7A607744) },
+	{ JSON__U64(0x11471CD7, 0x64AD4972), JSON__U64(0x87625F05, 0x6C7C4A8B) },
+	{ JSON__U64(0xD598E40D, 0x3DD89BCF), JSON__U64(0xA93AF6C6, 0xC79B5D2D) },
+	{ JSON__U64(0x4AFF1D10, 0x8D4EC2C3), JSON__U64(0xD389B478, 0x79823479) },
+	{ JSON__U64(0xCEDF722A, 0x585139BA), JSON__U64(0x843610CB, 0x4BF160CB) },
+	{ JSON__U64(0xC2974EB4, 0xEE658828), JSON__U64(0xA54394FE, 0x1EEDB8FE) },
+	{ JSON__U64(0x733D2262, 0x29FEEA32), JSON__U64(0xCE947A3D, 0xA6A9273E) },
+	{ JSON__U64(0x0806357D, 0x5A3F525F), JSON__U64(0x811CCC66, 0x8829B887) },
+	{ JSON__U64(0xCA07C2DC, 0xB0CF26F7), JSON__U64(0xA163FF80, 0x2A3426A8) },
+	{ JSON__U64(0xFC89B393, 0xDD02F0B5), JSON__U64(0xC9BCFF60, 0x34C13052) },
+	{ JSON__U64(0xBBAC2078, 0xD443ACE2), JSON__U64(0xFC2C3F38, 0x41F17C67) },
+	{ JSON__U64(0xD54B944B, 0x84AA4C0D), JSON__U64(0x9D9BA783, 0x2936EDC0) },
+	{ JSON__U64(0x0A9E795E, 0x65D4DF11), JSON__U64(0xC5029163, 0xF384A931) },
+	{ JSON__U64(0x4D4617B5, 0xFF4A16D5), JSON__U64(0xF64335BC, 0xF065D37D) },
+	{ JSON__U64(0x504BCED1, 0xBF8E4E45), JSON__U64(0x99EA0196, 0x163FA42E) },
+	{ JSON__U64(0xE45EC286, 0x2F71E1D6), JSON__U64(0xC06481FB, 0x9BCF8D39) },
+	{ JSON__U64(0x5D767327, 0xBB4E5A4C), JSON__U64(0xF07DA27A, 0x82C37088) },
+	{ JSON__U64(0x3A6A07F8, 0xD510F86F), JSON__U64(0x964E858C, 0x91BA2655) },
+	{ JSON__U64(0x890489F7, 0x0A55368B), JSON__U64(0xBBE226EF, 0xB628AFEA) },
+	{ JSON__U64(0x2B45AC74, 0xCCEA842E), JSON__U64(0xEADAB0AB, 0xA3B2DBE5) },
+	{ JSON__U64(0x3B0B8BC9, 0x0012929D), JSON__U64(0x92C8AE6B, 0x464FC96F) },
+	{ JSON__U64(0x09CE6EBB, 0x40173744), JSON__U64(0xB77ADA06, 0x17E3BBCB) },
+	{ JSON__U64(0xCC420A6A, 0x101D0515), JSON__U64(0xE5599087, 0x9DDCAABD) },
+	{ JSON__U64(0x9FA94682, 0x4A12232D), JSON__U64(0x8F57FA54, 0xC2A9EAB6) },
+	{ JSON__U64(0x47939822, 0xDC96ABF9), JSON__U64(0xB32DF8E9, 0xF3546564) },
+	{ JSON__U64(0x59787E2B, 0x93BC56F7), JSON__U64(0xDFF97724, 0x70297EBD) },
+	{ JSON__U64(0x57EB4EDB, 0x3C55B65A), JSON__U64(0x8BFBEA76, 0xC619EF36) },
+	{ JSON__U64(0xEDE62292, 0x0B6B23F1), JSON__U64(0xAEFAE514, 0x77A06B03) },
+	{ JSON__U64(0xE95FAB36, 0x8E45ECED), JSON__U64(0xDAB99E59, 0x958885C4) },
+	{ JSON__U64(0x11DBCB02, 0x18EBB414), JSON__U64(0x88B402F7, 0xFD75539B) },
+	{ JSON__U64(0xD652BDC2, 0x9F26A119), JSON__U64(0xAAE103B5, 0xFCD2A881) },
+	{ JSON__U64(0x4BE76D33, 0x46F0495F), JSON__U64(0xD59944A3, 0x7C0752A2) },
+	{ JSON__U64(0x6F70A440, 0x0C562DDB), JSON__U64(0x857FCAE6, 0x2D8493A5) },
+	{ JSON__U64(0xCB4CCD50, 0x0F6BB952), JSON__U64(0xA6DFBD9F, 0xB8E5B88E) },
+	{ JSON__U64(0x7E2000A4, 0x1346A7A7), JSON__U64(0xD097AD07, 0xA71F26B2) },
+	{ JSON__U64(0x8ED40066, 0x8C0C28C8), JSON__U64(0x825ECC24, 0xC873782F) },
+	{ JSON__U64(0x72890080, 0x2F0F32FA), JSON__U64(0xA2F67F2D, 0xFA90563B) },
+	{ JSON__U64(0x4F2B40A0, 0x3AD2FFB9), JSON__U64(0xCBB41EF9, 0x79346BCA) },
+	{ JSON__U64(0xE2F610C8, 0x4987BFA8), JSON__U64(0xFEA126B7, 0xD78186BC) },
+	{ JSON__U64(0x0DD9CA7D, 0x2DF4D7C9), JSON__U64(0x9F24B832, 0xE6B0F436) },
+	{ JSON__U64(0x91503D1C, 0x79720DBB), JSON__U64(0xC6EDE63F, 0xA05D3143) },
+	{ JSON__U64(0x75A44C63, 0x97CE912A), JSON__U64(0xF8A95FCF, 0x88747D94) },
+	{ JSON__U64(0xC986AFBE, 0x3EE11ABA), JSON__U64(0x9B69DBE1, 0xB548CE7C) },
+	{ JSON__U64(0xFBE85BAD, 0xCE996168), JSON__U64(0xC24452DA, 0x229B021B) },
+	{ JSON__U64(0xFAE27299, 0x423FB9C3), JSON__U64(0xF2D56790, 0xAB41C2A2) },
+	{ JSON__U64(0xDCCD879F, 0xC967D41A), JSON__U64(0x97C560BA, 0x6B0919A5) },
+	{ JSON__U64(0x5400E987, 0xBBC1C920), JSON__U64(0xBDB6B8E9, 0x05CB600F) },
+	{ JSON__U64(0x290123E9, 0xAAB23B68), JSON__U64(0xED246723, 0x473E3813) },
+	{ JSON__U64(0xF9A0B672, 0x0AAF6521), JSON__U64(0x9436C076, 0x0C86E30B) },
+	{ JSON__U64(0xF808E40E, 0x8D5B3E69), JSON__U64(0xB9447093, 0x8FA89BCE) },
+	{ JSON__U64(0xB60B1D12, 0x30B20E04), JSON__U64(0xE7958CB8, 0x7392C2C2) },
+	{ JSON__U64(0xB1C6F22B, 0x5E6F48C2), JSON__U64(0x90BD77F3, 0x483BB9B9) },
+	{ JSON__U64(0x1E38AEB6, 0x360B1AF3), JSON__U64(0xB4ECD5F0, 0x1A4AA828) },
+	{ JSON__U64(0x25C6DA63, 0xC38DE1B0), JSON__U64(0xE2280B6C, 0x20DD5232) },
+	{ JSON__U64(0x579C487E, 0x5A38AD0E), JSON__U64(0x8D590723, 0x948A535F) },
+	{ JSON__U64(0x2D835A9D, 0xF0C6D851), JSON__U64(0xB0AF48EC, 0x79ACE837) },
+	{ JSON__U64(0xF8E43145, 0x6CF88E65), JSON__U64(0xDCDB1B27, 0x98182244) },
+	{ JSON__U64(0x1B8E9ECB, 0x641B58FF), JSON__U64(0x8A08F0F8, 0xBF0F156B) },
+	{ JSON__U64(0xE272467E, 0x3D222F3F), JSON__U64(0xAC8B2D36, 0xEED2DAC5) },
+	{ JSON__U64(0x5B0ED81D, 0xCC6ABB0F), JSON__U64(0xD7ADF884, 0xAA879177) },
+	{ JSON__U64(0x98E94712, 0x9FC2B4E9), JSON__U64(0x86CCBB52, 0xEA94BAEA) },
+	{ JSON__U64(0x3F2398D7, 0x47B36224), JSON__U64(0xA87FEA27, 0xA539E9A5) },
+	{ JSON__U64(0x8EEC7F0D, 0x19A03AAD), JSON__U64(0xD29FE4B1, 0x8E88640E) },
+	{ JSON__U64(0x1953CF68, 0x300424AC), JSON__U64(0x83A3EEEE, 0xF9153E89) },
+	{ JSON__U64(0x5FA8C342, 0x3C052DD7), JSON__U64(0xA48CEAAA, 0xB75A8E2B) },
+	{ JSON__U64(0x3792F412, 0xCB06794D), JSON__U64(0xCDB02555, 0x653131B6) },
+	{ JSON__U64(0xE2BBD88B, 0xBEE40BD0), JSON__U64(0x808E1755, 0x5F3EBF11) },
+	{ JSON__U64(0x5B6ACEAE, 0xAE9D0EC4), JSON__U64(0xA0B19D2A, 0xB70E6ED6) },
+	{ JSON__U64(0xF245825A, 0x5A445275), JSON__U64(0xC8DE0475, 0x64D20A8B) },
+	{ JSON__U64(0xEED6E2F0, 0xF0D56712), JSON__U64(0xFB158592, 0xBE068D2E) },
+	{ JSON__U64(0x55464DD6, 0x9685606B), JSON__U64(0x9CED737B, 0xB6C4183D) },
+	{ JSON__U64(0xAA97E14C, 0x3C26B886), JSON__U64(0xC428D05A, 0xA4751E4C) },
+	{ JSON__U64(0xD53DD99F, 0x4B3066A8), JSON__U64(0xF5330471, 0x4D9265DF) },
+	{ JSON__U64(0xE546A803, 0x8EFE4029), JSON__U64(0x993FE2C6, 0xD07B7FAB) },
+	{ JSON__U64(0xDE985204, 0x72BDD033), JSON__U64(0xBF8FDB78, 0x849A5F96) },
+	{ JSON__U64(0x963E6685, 0x8F6D4440), JSON__U64(0xEF73D256, 0xA5C0F77C) },
+	{ JSON__U64(0xDDE70013, 0x79A44AA8), JSON__U64(0x95A86376, 0x27989AAD) },
+	{ JSON__U64(0x5560C018, 0x580D5D52), JSON__U64(0xBB127C53, 0xB17EC159) },
+	{ JSON__U64(0xAAB8F01E, 0x6E10B4A6), JSON__U64(0xE9D71B68, 0x9DDE71AF) },
+	{ JSON__U64(0xCAB39613, 0x04CA70E8), JSON__U64(0x92267121, 0x62AB070D) },
+	{ JSON__U64(0x3D607B97, 0xC5FD0D22), JSON__U64(0xB6B00D69, 0xBB55C8D1) },
+	{ JSON__U64(0x8CB89A7D, 0xB77C506A), JSON__U64(0xE45C10C4, 0x2A2B3B05) },
+	{ JSON__U64(0x77F3608E, 0x92ADB242), JSON__U64(0x8EB98A7A, 0x9A5B04E3) },
+	{ JSON__U64(0x55F038B2, 0x37591ED3), JSON__U64(0xB267ED19, 0x40F1C61C) },
+	{ JSON__U64(0x6B6C46DE, 0xC52F6688), JSON__U64(0xDF01E85F, 0x912E37A3) },
+	{ JSON__U64(0x2323AC4B, 0x3B3DA015), JSON__U64(0x8B61313B, 0xBABCE2C6) },
+	{ JSON__U64(0xABEC975E, 0x0A0D081A), JSON__U64(0xAE397D8A, 0xA96C1B77) },
+	{ JSON__U64(0x96E7BD35, 0x8C904A21), JSON__U64(0xD9C7DCED, 0x53C72255) },
+	{ JSON__U64(0x7E50D641, 0x77DA2E54), JSON__U64(0x881CEA14, 0x545C7575) },
+	{ JSON__U64(0xDDE50BD1, 0xD5D0B9E9), JSON__U64(0xAA242499, 0x697392D2) },
+	{ JSON__U64(0x955E4EC6, 0x4B44E864), JSON__U64(0xD4AD2DBF, 0xC3D07787) },
+	{ JSON__U64(0xBD5AF13B, 0xEF0B113E), JSON__U64(0x84EC3C97, 0xDA624AB4) },
+	{ JSON__U64(0xECB1AD8A, 0xEACDD58E), JSON__U64(0xA6274BBD, 0xD0FADD61) },
+	{ JSON__U64(0x67DE18ED, 0xA5814AF2), JSON__U64(0xCFB11EAD, 0x453994BA) },
+	{ JSON__U64(0x80EACF94, 0x8770CED7), JSON__U64(0x81CEB32C, 0x4B43FCF4) },
+	{ JSON__U64(0xA1258379, 0xA94D028D), JSON__U64(0xA2425FF7, 0x5E14FC31) },
+	{ JSON__U64(0x096EE458, 0x13A04330), JSON__U64(0xCAD2F7F5, 0x359A3B3E) },
+	{ JSON__U64(0x8BCA9D6E, 0x188853FC), JSON__U64(0xFD87B5F2, 0x8300CA0D) },
+	{ JSON__U64(0x775EA264, 0xCF55347D), JSON__U64(0x9E74D1B7, 0x91E07E48) },
+	{ JSON__U64(0x95364AFE, 0x032A819D), JSON__U64(0xC6120625, 0x76589DDA) },
+	{ JSON__U64(0x3A83DDBD, 0x83F52204), JSON__U64(0xF79687AE, 0xD3EEC551) },
+	{ JSON__U64(0xC4926A96, 0x72793542), JSON__U64(0x9ABE14CD, 0x44753B52) },
+	{ JSON__U64(0x75B7053C, 0x0F178293), JSON__U64(0xC16D9A00, 0x95928A27) },
+	{ JSON__U64(0x5324C68B, 0x12DD6338), JSON__U64(0xF1C90080, 0xBAF72CB1) },
+	{ JSON__U64(0xD3F6FC16, 0xEBCA5E03), JSON__U64(0x971DA050, 0x74DA7BEE) },
+	{ JSON__U64(0x88F4BB1C, 0xA6BCF584), JSON__U64(0xBCE50864, 0x92111AEA) },
+	{ JSON__U64(0x2B31E9E3, 0xD06C32E5), JSON__U64(0xEC1E4A7D, 0xB69561A5) },
+	{ JSON__U64(0x3AFF322E, 0x62439FCF), JSON__U64(0x9392EE8E, 0x921D5D07) },
+	{ JSON__U64(0x09BEFEB9, 0xFAD487C2), JSON__U64(0xB877AA32, 0x36A4B449) },
+	{ JSON__U64(0x4C2EBE68, 0x7989A9B3), JSON__U64(0xE69594BE, 0xC44DE15B) },
+	{ JSON__U64(0x0F9D3701, 0x4BF60A10), JSON__U64(0x901D7CF7, 0x3AB0ACD9) },
+	{ JSON__U64(0x538484C1, 0x9EF38C94), JSON__U64(0xB424DC35, 0x095CD80F) },
+	{ JSON__U64(0x2865A5F2, 0x06B06FB9), JSON__U64(0xE12E1342, 0x4BB40E13) },
+	{ JSON__U64(0xF93F87B7, 0x442E45D3), JSON__U64(0x8CBCCC09, 0x6F5088CB) },
+	{ JSON__U64(0xF78F69A5, 0x1539D748), JSON__U64(0xAFEBFF0B, 0xCB24AAFE) },
+	{ JSON__U64(0xB573440E, 0x5A884D1B), JSON__U64(0xDBE6FECE, 0xBDEDD5BE) },
+	{ JSON__U64(0x31680A88, 0xF8953030), JSON__U64(0x89705F41, 0x36B4A597) },
+	{ JSON__U64(0xFDC20D2B, 0x36BA7C3D), JSON__U64(0xABCC7711, 0x8461CEFC) },
+	{ JSON__U64(0x3D329076, 0x04691B4C), JSON__U64(0xD6BF94D5, 0xE57A42BC) },
+	{ JSON__U64(0xA63F9A49, 0xC2C1B10F), JSON__U64(0x8637BD05, 0xAF6C69B5) },
+	{ JSON__U64(0x0FCF80DC, 0x33721D53), JSON__U64(0xA7C5AC47, 0x1B478423) },
+	{ JSON__U64(0xD3C36113, 0x404EA4A8), JSON__U64(0xD1B71758, 0xE219652B) },
+	{ JSON__U64(0x645A1CAC, 0x083126E9), JSON__U64(0x83126E97, 0x8D4FDF3B) },
+	{ JSON__U64(0x3D70A3D7, 0x0A3D70A3), JSON__U64(0xA3D70A3D, 0x70A3D70A) },
+	{ JSON__U64(0xCCCCCCCC, 0xCCCCCCCC), JSON__U64(0xCCCCCCCC, 0xCCCCCCCC) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x80000000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xA0000000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xC8000000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xFA000000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x9C400000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xC3500000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xF4240000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x98968000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xBEBC2000, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xEE6B2800, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x9502F900, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xBA43B740, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xE8D4A510, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x9184E72A, 0x00000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xB5E620F4, 0x80000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xE35FA931, 0xA0000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x8E1BC9BF, 0x04000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xB1A2BC2E, 0xC5000000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xDE0B6B3A, 0x76400000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x8AC72304, 0x89E80000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xAD78EBC5, 0xAC620000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xD8D726B7, 0x177A8000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x87867832, 0x6EAC9000) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xA968163F, 0x0A57B400) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xD3C21BCE, 0xCCEDA100) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0x84595161, 0x401484A0) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xA56FA5B9, 0x9019A5C8) },
+	{ JSON__U64(0x00000000, 0x00000000), JSON__U64(0xCECB8F27, 0xF4200F3A) },
+	{ JSON__U64(0x40000000, 0x00000000), JSON__U64(0x813F3978, 0xF8940984) },
+	{ JSON__U64(0x50000000, 0x00000000), JSON__U64(0xA18F07D7, 0x36B90BE5) },
+	{ JSON__U64(0xA4000000, 0x00000000), JSON__U64(0xC9F2C9CD, 0x04674EDE) },
+	{ JSON__U64(0x4D000000, 0x00000000), JSON__U64(0xFC6F7C40, 0x45812296) },
+	{ JSON__U64(0xF0200000, 0x00000000), JSON__U64(0x9DC5ADA8, 0x2B70B59D) },
+	{ JSON__U64(0x6C280000, 0x00000000), JSON__U64(0xC5371912, 0x364CE305) },
+	{ JSON__U64(0xC7320000, 0x00000000), JSON__U64(0xF684DF56, 0xC3E01BC6) },
+	{ JSON__U64(0x3C7F4000, 0x00000000), JSON__U64(0x9A130B96, 0x3A6C115C) },
+	{ JSON__U64(0x4B9F1000, 0x00000000), JSON__U64(0xC097CE7B, 0xC90715B3) },
+	{ JSON__U64(0x1E86D400, 0x00000000), JSON__U64(0xF0BDC21A, 0xBB48DB20) },
+	{ JSON__U64(0x13144480, 0x00000000), JSON__U64(0x96769950, 0xB50D88F4) },
+	{ JSON__U64(0x17D955A0, 0x00000000), JSON__U64(0xBC143FA4, 0xE250EB31) },
+	{ JSON__U64(0x5DCFAB08, 0x00000000), JSON__U64(0xEB194F8E, 0x1AE525FD) },
+	{ JSON__U64(0x5AA1CAE5, 0x00000000), JSON__U64(0x92EFD1B8, 0xD0CF37BE) },
+	{ JSON__U64(0xF14A3D9E, 0x40000000), JSON__U64(0xB7ABC627, 0x050305AD) },
+	{ JSON__U64(0x6D9CCD05, 0xD0000000), JSON__U64(0xE596B7B0, 0xC643C719) },
+	{ JSON__U64(0xE4820023, 0xA2000000), JSON__U64(0x8F7E32CE, 0x7BEA5C6F) },
+	{ JSON__U64(0xDDA2802C, 0x8A800000), JSON__U64(0xB35DBF82, 0x1AE4F38B) },
+	{ JSON__U64(0xD50B2037, 0xAD200000), JSON__U64(0xE0352F62, 0xA19E306E) },
+	{ JSON__U64(0x4526F422, 0xCC340000), JSON__U64(0x8C213D9D, 0xA502DE45) },
+	{ JSON__U64(0x9670B12B, 0x7F410000), JSON__U64(0xAF298D05, 0x0E4395D6) },
+	{ JSON__U64(0x3C0CDD76, 0x5F114000), JSON__U64(0xDAF3F046, 0x51D47B4C) },
+	{ JSON__U64(0xA5880A69, 0xFB6AC800), JSON__U64(0x88D8762B, 0xF324CD0F) },
+	{ JSON__U64(0x8EEA0D04, 0x7A457A00), JSON__U64(0xAB0E93B6, 0xEFEE0053) },
+	{ JSON__U64(0x72A49045, 0x98D6D880), JSON__U64(0xD5D238A4, 0xABE98068) },
+	{ JSON__U64(0x47A6DA2B, 0x7F864750), JSON__U64(0x85A36366, 0xEB71F041) },
+	{ JSON__U64(0x999090B6, 0x5F67D924), JSON__U64(0xA70C3C40, 0xA64E6C51) },
+	{ JSON__U64(0xFFF4B4E3, 0xF741CF6D), JSON__U64(0xD0CF4B50, 0xCFE20765) },
+	{ JSON__U64(0xBFF8F10E, 0x7A8921A4), JSON__U64(0x82818F12, 0x81ED449F) },
+	{ JSON__U64(0xAFF72D52, 0x192B6A0D), JSON__U64(0xA321F2D7, 0x226895C7) },
+	{ JSON__U64(0x9BF4F8A6, 0x9F764490), JSON__U64(0xCBEA6F8C, 0xEB02BB39) },
+	{ JSON__U64(0x02F236D0, 0x4753D5B4), JSON__U64(0xFEE50B70, 0x25C36A08) },
+	{ JSON__U64(0x01D76242, 0x2C946590), JSON__U64(0x9F4F2726, 0x179A2245) },
+	{ JSON__U64(0x424D3AD2, 0xB7B97EF5), JSON__U64(0xC722F0EF, 0x9D80AAD6) },
+	{ JSON__U64(0xD2E08987, 0x65A7DEB2), JSON__U64(0xF8EBAD2B, 0x84E0D58B) },
+	{ JSON__U64(0x63CC55F4, 0x9F88EB2F), JSON__U64(0x9B934C3B, 0x330C8577) },
+	{ JSON__U64(0x3CBF6B71, 0xC76B25FB), JSON__U64(0xC2781F49, 0xFFCFA6D5) },
+	{ JSON__U64(0x8BEF464E, 0x3945EF7A), JSON__U64(0xF316271C, 0x7FC3908A) },
+	{ JSON__U64(0x97758BF0, 0xE3CBB5AC), JSON__U64(0x97EDD871, 0xCFDA3A56) },
+	{ JSON__U64(0x3D52EEED, 0x1CBEA317), JSON__U64(0xBDE94E8E, 0x43D0C8EC) },
+	{ JSON__U64(0x4CA7AAA8, 0x63EE4BDD), JSON__U64(0xED63A231, 0xD4C4FB27) },
+	{ JSON__U64(0x8FE8CAA9, 0x3E74EF6A), JSON__U64(0x945E455F, 0x24FB1CF8) },
+	{ JSON__U64(0xB3E2FD53, 0x8E122B44), JSON__U64(0xB975D6B6, 0xEE39E436) },
+	{ JSON__U64(0x60DBBCA8, 0x7196B616), JSON__U64(0xE7D34C64, 0xA9C85D44) },
+	{ JSON__U64(0xBC8955E9, 0x46FE31CD), JSON__U64(0x90E40FBE, 0xEA1D3A4A) },
+	{ JSON__U64(0x6BABAB63, 0x98BDBE41), JSON__U64(0xB51D13AE, 0xA4A488DD) },
+	{ JSON__U64(0xC696963C, 0x7EED2DD1), JSON__U64(0xE264589A, 0x4DCDAB14) },
+	{ JSON__U64(0xFC1E1DE5, 0xCF543CA2), JSON__U64(0x8D7EB760, 0x70A08AEC) },
+	{ JSON__U64(0x3B25A55F, 0x43294BCB), JSON__U64(0xB0DE6538, 0x8CC8ADA8) },
+	{ JSON__U64(0x49EF0EB7, 0x13F39EBE), JSON__U64(0xDD15FE86, 0xAFFAD912) },
+	{ JSON__U64(0x6E356932, 0x6C784337), JSON__U64(0x8A2DBF14, 0x2DFCC7AB) },
+	{ JSON__U64(0x49C2C37F, 0x07965404), JSON__U64(0xACB92ED9, 0x397BF996) },
+	{ JSON__U64(0xDC33745E, 0xC97BE906), JSON__U64(0xD7E77A8F, 0x87DAF7FB) },
+	{ JSON__U64(0x69A028BB, 0x3DED71A3), JSON__U64(0x86F0AC99, 0xB4E8DAFD) },
+	{ JSON__U64(0xC40832EA, 0x0D68CE0C), JSON__U64(0xA8ACD7C0, 0x222311BC) },
+	{ JSON__U64(0xF50A3FA4, 0x90C30190), JSON__U64(0xD2D80DB0, 0x2AABD62B) },
+	{ JSON__U64(0x792667C6, 0xDA79E0FA), JSON__U64(0x83C7088E, 0x1AAB65DB) },
+	{ JSON__U64(0x577001B8, 0x91185938), JSON__U64(0xA4B8CAB1, 0xA1563F52) },
+	{ JSON__U64(0xED4C0226, 0xB55E6F86), JSON__U64(0xCDE6FD5E, 0x09ABCF26) },
+	{ JSON__U64(0x544F8158, 0x315B05B4), JSON__U64(0x80B05E5A, 0xC60B6178) },
+	{ JSON__U64(0x696361AE, 0x3DB1C721), JSON__U64(0xA0DC75F1, 0x778E39D6) },
+	{ JSON__U64(0x03BC3A19, 0xCD1E38E9), JSON__U64(0xC913936D, 0xD571C84C) },
+	{ JSON__U64(0x04AB48A0, 0x4065C723), JSON__U64(0xFB587849, 0x4ACE3A5F) },
+	{ JSON__U64(0x62EB0D64, 0x283F9C76), JSON__U64(0x9D174B2D, 0xCEC0E47B) },
+	{ JSON__U64(0x3BA5D0BD, 0x324F8394), JSON__U64(0xC45D1DF9, 0x42711D9A) },
+	{ JSON__U64(0xCA8F44EC, 0x7EE36479), JSON__U64(0xF5746577, 0x930D6500) },
+	{ JSON__U64(0x7E998B13, 0xCF4E1ECB), JSON__U64(0x9968BF6A, 0xBBE85F20) },
+	{ JSON__U64(0x9E3FEDD8, 0xC321A67E), JSON__U64(0xBFC2EF45, 0x6AE276E8) },
+	{ JSON__U64(0xC5CFE94E, 0xF3EA101E), JSON__U64(0xEFB3AB16, 0xC59B14A2) },
+	{ JSON__U64(0xBBA1F1D1, 0x58724A12), JSON__U64(0x95D04AEE, 0x3B80ECE5) },
+	{ JSON__U64(0x2A8A6E45, 0xAE8EDC97), JSON__U64(0xBB445DA9, 0xCA61281F) },
+	{ JSON__U64(0xF52D09D7, 0x1A3293BD), JSON__U64(0xEA157514, 0x3CF97226) },
+	{ JSON__U64(0x593C2626, 0x705F9C56), JSON__U64(0x924D692C, 0xA61BE758) },
+	{ JSON__U64(0x6F8B2FB0, 0x0C77836C), JSON__U64(0xB6E0C377, 0xCFA2E12E) },
+	{ JSON__U64(0x0B6DFB9C, 0x0F956447), JSON__U64(0xE498F455, 0xC38B997A) },
+	{ JSON__U64(0x4724BD41, 0x89BD5EAC), JSON__U64(0x8EDF98B5, 0x9A373FEC) },
+	{ JSON__U64(0x58EDEC91, 0xEC2CB657), JSON__U64(0xB2977EE3, 0x00C50FE7) },
+	{ JSON__U64(0x2F2967B6, 0x6737E3ED), JSON__U64(0xDF3D5E9B, 0xC0F653E1) },
+	{ JSON__U64(0xBD79E0D2, 0x0082EE74), JSON__U64(0x8B865B21, 0x5899F46C) },
+	{ JSON__U64(0xECD85906, 0x80A3AA11), JSON__U64(0xAE67F1E9, 0xAEC07187) },
+	{ JSON__U64(0xE80E6F48, 0x20CC9495), JSON__U64(0xDA01EE64, 0x1A708DE9) },
+	{ JSON__U64(0x3109058D, 0x147FDCDD), JSON__U64(0x884134FE, 0x908658B2) },
+	{ JSON__U64(0xBD4B46F0, 0x599FD415), JSON__U64(0xAA51823E, 0x34A7EEDE) },
+	{ JSON__U64(0x6C9E18AC, 0x7007C91A), JSON__U64(0xD4E5E2CD, 0xC1D1EA96) },
+	{ JSON__U64(0x03E2CF6B, 0xC604DDB0), JSON__U64(0x850FADC0, 0x9923329E) },
+	{ JSON__U64(0x84DB8346, 0xB786151C), JSON__U64(0xA6539930, 0xBF6BFF45) },
+	{ JSON__U64(0xE6126418, 0x65679A63), JSON__U64(0xCFE87F7C, 0xEF46FF16) },
+	{ JSON__U64(0x4FCB7E8F, 0x3F60C07E), JSON__U64(0x81F14FAE, 0x158C5F6E) },
+	{ JSON__U64(0xE3BE5E33, 0x0F38F09D), JSON__U64(0xA26DA399, 0x9AEF7749) },
+	{ JSON__U64(0x5CADF5BF, 0xD3072CC5), JSON__U64(0xCB090C80, 0x01AB551C) },
+	{ JSON__U64(0x73D9732F, 0xC7C8F7F6), JSON__U64(0xFDCB4FA0, 0x02162A63) },
+	{ JSON__U64(0x2867E7FD, 0xDCDD9AFA), JSON__U64(0x9E9F11C4, 0x014DDA7E) },
+	{ JSON__U64(0xB281E1FD, 0x541501B8), JSON__U64(0xC646D635, 0x01A1511D) },
+	{ JSON__U64(0x1F225A7C, 0xA91A4226), JSON__U64(0xF7D88BC2, 0x4209A565) },
+	{ JSON__U64(0x3375788D, 0xE9B06958), JSON__U64(0x9AE75759, 0x6946075F) },
+	{ JSON__U64(0x0052D6B1, 0x641C83AE), JSON__U64(0xC1A12D2F, 0xC3978937) },
+	{ JSON__U64(0xC0678C5D, 0xBD23A49A), JSON__U64(0xF209787B, 0xB47D6B84) },
+	{ JSON__U64(0xF840B7BA, 0x963646E0), JSON__U64(0x9745EB4D, 0x50CE6332) },
+	{ JSON__U64(0xB650E5A9, 0x3BC3D898), JSON__U64(0xBD176620, 0xA501FBFF) },
+	{ JSON__U64(0xA3E51F13, 0x8AB4CEBE), JSON__U64(0xEC5D3FA8, 0xCE427AFF) },
+	{ JSON__U64(0xC66F336C, 0x36B10137), JSON__U64(0x93BA47C9, 0x80E98CDF) },
+	{ JSON__U64(0xB80B0047, 0x445D4184), JSON__U64(0xB8A8D9BB, 0xE123F017) },
+	{ JSON__U64(0xA60DC059, 0x157491E5), JSON__U64(0xE6D3102A, 0xD96CEC1D) },
+	{ JSON__U64(0x87C89837, 0xAD68DB2F), JSON__U64(0x9043EA1A, 0xC7E41392) },
+	{ JSON__U64(0x29BABE45, 0x98C311FB), JSON__U64(0xB454E4A1, 0x79DD1877) },
+	{ JSON__U64(0xF4296DD6, 0xFEF3D67A), JSON__U64(0xE16A1DC9, 0xD8545E94) },
+	{ JSON__U64(0x1899E4A6, 0x5F58660C), JSON__U64(0x8CE2529E, 0x2734BB1D) },
+	{ JSON__U64(0x5EC05DCF, 0xF72E7F8F), JSON__U64(0xB01AE745, 0xB101E9E4) },
+	{ JSON__U64(0x76707543, 0xF4FA1F73), JSON__U64(0xDC21A117, 0x1D42645D) },
+	{ JSON__U64(0x6A06494A, 0x791C53A8), JSON__U64(0x899504AE, 0x72497EBA) },
+	{ JSON__U64(0x0487DB9D, 0x17636892), JSON__U64(0xABFA45DA, 0x0EDBDE69) },
+	{ JSON__U64(0x45A9D284, 0x5D3C42B6), JSON__U64(0xD6F8D750, 0x9292D603) },
+	{ JSON__U64(0x0B8A2392, 0xBA45A9B2), JSON__U64(0x865B8692, 0x5B9BC5C2) },
+	{ JSON__U64(0x8E6CAC77, 0x68D7141E), JSON__U64(0xA7F26836, 0xF282B732) },
+	{ JSON__U64(0x3207D795, 0x430CD926), JSON__U64(0xD1EF0244, 0xAF2364FF) },
+	{ JSON__U64(0x7F44E6BD, 0x49E807B8), JSON__U64(0x8335616A, 0xED761F1F) },
+	{ JSON__U64(0x5F16206C, 0x9C6209A6), JSON__U64(0xA402B9C5, 0xA8D3A6E7) },
+	{ JSON__U64(0x36DBA887, 0xC37A8C0F), JSON__U64(0xCD036837, 0x130890A1) },
+	{ JSON__U64(0xC2494954, 0xDA2C9789), JSON__U64(0x80222122, 0x6BE55A64) },
+	{ JSON__U64(0xF2DB9BAA, 0x10B7BD6C), JSON__U64(0xA02AA96B, 0x06DEB0FD) },
+	{ JSON__U64(0x6F928294, 0x94E5ACC7), JSON__U64(0xC83553C5, 0xC8965D3D) },
+	{ JSON__U64(0xCB772339, 0xBA1F17F9), JSON__U64(0xFA42A8B7, 0x3ABBF48C) },
+	{ JSON__U64(0xFF2A7604, 0x14536EFB), JSON__U64(0x9C69A972, 0x84B578D7) },
+	{ JSON__U64(0xFEF51385, 0x19684ABA), JSON__U64(0xC38413CF, 0x25E2D70D) },
+	{ JSON__U64(0x7EB25866, 0x5FC25D69), JSON__U64(0xF46518C2, 0xEF5B8CD1) },
+	{ JSON__U64(0xEF2F773F, 0xFBD97A61), JSON__U64(0x98BF2F79, 0xD5993802) },
+	{ JSON__U64(0xAAFB550F, 0xFACFD8FA), JSON__U64(0xBEEEFB58, 0x4AFF8603) },
+	{ JSON__U64(0x95BA2A53, 0xF983CF38), JSON__U64(0xEEAABA2E, 0x5DBF6784) },
+	{ JSON__U64(0xDD945A74, 0x7BF26183), JSON__U64(0x952AB45C, 0xFA97A0B2) },
+	{ JSON__U64(0x94F97111, 0x9AEEF9E4), JSON__U64(0xBA756174, 0x393D88DF) },
+	{ JSON__U64(0x7A37CD56, 0x01AAB85D), JSON__U64(0xE912B9D1, 0x478CEB17) },
+	{ JSON__U64(0xAC62E055, 0xC10AB33A), JSON__U64(0x91ABB422, 0xCCB812EE) },
+	{ JSON__U64(0x577B986B, 0x314D6009), JSON__U64(0xB616A12B, 0x7FE617AA) },
+	{ JSON__U64(0xED5A7E85, 0xFDA0B80B), JSON__U64(0xE39C4976, 0x5FDF9D94) },
+	{ JSON__U64(0x14588F13, 0xBE847307), JSON__U64(0x8E41ADE9, 0xFBEBC27D) },
+	{ JSON__U64(0x596EB2D8, 0xAE258FC8), JSON__U64(0xB1D21964, 0x7AE6B31C) },
+	{ JSON__U64(0x6FCA5F8E, 0xD9AEF3BB), JSON__U64(0xDE469FBD, 0x99A05FE3) },
+	{ JSON__U64(0x25DE7BB9, 0x480D5854), JSON__U64(0x8AEC23D6, 0x80043BEE) },
+	{ JSON__U64(0xAF561AA7, 0x9A10AE6A), JSON__U64(0xADA72CCC, 0x20054AE9) },
+	{ JSON__U64(0x1B2BA151, 0x8094DA04), JSON__U64(0xD910F7FF, 0x28069DA4) },
+	{ JSON__U64(0x90FB44D2, 0xF05D0842), JSON__U64(0x87AA9AFF, 0x79042286) },
+	{ JSON__U64(0x353A1607, 0xAC744A53), JSON__U64(0xA99541BF, 0x57452B28) },
+	{ JSON__U64(0x42889B89, 0x97915CE8), JSON__U64(0xD3FA922F, 0x2D1675F2) },
+	{ JSON__U64(0x69956135, 0xFEBADA11), JSON__U64(0x847C9B5D, 0x7C2E09B7) },
+	{ JSON__U64(0x43FAB983, 0x7E699095), JSON__U64(0xA59BC234, 0xDB398C25) },
+	{ JSON__U64(0x94F967E4, 0x5E03F4BB), JSON__U64(0xCF02B2C2, 0x1207EF2E) },
+	{ JSON__U64(0x1D1BE0EE, 0xBAC278F5), JSON__U64(0x8161AFB9, 0x4B44F57D) },
+	{ JSON__U64(0x6462D92A, 0x69731732), JSON__U64(0xA1BA1BA7, 0x9E1632DC) },
+	{ JSON__U64(0x7D7B8F75, 0x03CFDCFE), JSON__U64(0xCA28A291, 0x859BBF93) },
+	{ JSON__U64(0x5CDA7352, 0x44C3D43E), JSON__U64(0xFCB2CB35, 0xE702AF78) },
+	{ JSON__U64(0x3A088813, 0x6AFA64A7), JSON__U64(0x9DEFBF01, 0xB061ADAB) },
+	{ JSON__U64(0x088AAA18, 0x45B8FDD0), JSON__U64(0xC56BAEC2, 0x1C7A1916) },
+	{ JSON__U64(0x8AAD549E, 0x57273D45), JSON__U64(0xF6C69A72, 0xA3989F5B) },
+	{ JSON__U64(0x36AC54E2, 0xF678864B), JSON__U64(0x9A3C2087, 0xA63F6399) },
+	{ JSON__U64(0x84576A1B, 0xB416A7DD), JSON__U64(0xC0CB28A9, 0x8FCF3C7F) },
+	{ JSON__U64(0x656D44A2, 0xA11C51D5), JSON__U64(0xF0FDF2D3, 0xF3C30B9F) },
+	{ JSON__U64(0x9F644AE5, 0xA4B1B325), JSON__U64(0x969EB7C4, 0x7859E743) },
+	{ JSON__U64(0x873D5D9F, 0x0DDE1FEE), JSON__U64(0xBC4665B5, 0x96706114) },
+	{ JSON__U64(0xA90CB506, 0xD155A7EA), JSON__U64(0xEB57FF22, 0xFC0C7959) },
+	{ JSON__U64(0x09A7F124, 0x42D588F2), JSON__U64(0x9316FF75, 0xDD87CBD8) },
+	{ JSON__U64(0x0C11ED6D, 0x538AEB2F), JSON__U64(0xB7DCBF53, 0x54E9BECE) },
+	{ JSON__U64(0x8F1668C8, 0xA86DA5FA), JSON__U64(0xE5D3EF28, 0x2A242E81) },
+	{ JSON__U64(0xF96E017D, 0x694487BC), JSON__U64(0x8FA47579, 0x1A569D10) },
+	{ JSON__U64(0x37C981DC, 0xC395A9AC), JSON__U64(0xB38D92D7, 0x60EC4455) },
+	{ JSON__U64(0x85BBE253, 0xF47B1417), JSON__U64(0xE070F78D, 0x3927556A) },
+	{ JSON__U64(0x93956D74, 0x78CCEC8E), JSON__U64(0x8C469AB8, 0x43B89562) },
+	{ JSON__U64(0x387AC8D1, 0x970027B2), JSON__U64(0xAF584166, 0x54A6BABB) },
+	{ JSON__U64(0x06997B05, 0xFCC0319E), JSON__U64(0xDB2E51BF, 0xE9D0696A) },
+	{ JSON__U64(0x441FECE3, 0xBDF81F03), JSON__U64(0x88FCF317, 0xF22241E2) },
+	{ JSON__U64(0xD527E81C, 0xAD7626C3), JSON__U64(0xAB3C2FDD, 0xEEAAD25A) },
+	{ JSON__U64(0x8A71E223, 0xD8D3B074), JSON__U64(0xD60B3BD5, 0x6A5586F1) },
+	{ JSON__U64(0xF6872D56, 0x67844E49), JSON__U64(0x85C70565, 0x62757456) },
+	{ JSON__U64(0xB428F8AC, 0x016561DB), JSON__U64(0xA738C6BE, 0xBB12D16C) },
+	{ JSON__U64(0xE13336D7, 0x01BEBA52), JSON__U64(0xD106F86E, 0x69D785C7) },
+	{ JSON__U64(0xECC00246, 0x61173473), JSON__U64(0x82A45B45, 0x0226B39C) },
+	{ JSON__U64(0x27F002D7, 0xF95D0190), JSON__U64(0xA34D7216, 0x42B06084) },
+	{ JSON__U64(0x31EC038D, 0xF7B441F4), JSON__U64(0xCC20CE9B, 0xD35C78A5) },
+	{ JSON__U64(0x7E670471, 0x75A15271), JSON__U64(0xFF290242, 0xC83396CE) },
+	{ JSON__U64(0x0F0062C6, 0xE984D386), JSON__U64(0x9F79A169, 0xBD203E41) },
+	{ JSON__U64(0x52C07B78, 0xA3E60868), JSON__U64(0xC75809C4, 0x2C684DD1) },
+	{ JSON__U64(0xA7709A56, 0xCCDF8A82), JSON__U64(0xF92E0C35, 0x37826145) },
+	{ JSON__U64(0x88A66076, 0x400BB691), JSON__U64(0x9BBCC7A1, 0x42B17CCB) },
+	{ JSON__U64(0x6ACFF893, 0xD00EA435), JSON__U64(0xC2ABF989, 0x935DDBFE) },
+	{ JSON__U64(0x0583F6B8, 0xC4124D43), JSON__U64(0xF356F7EB, 0xF83552FE) },
+	{ JSON__U64(0xC3727A33, 0x7A8B704A), JSON__U64(0x98165AF3, 0x7B2153DE) },
+	{ JSON__U64(0x744F18C0, 0x592E4C5C), JSON__U64(0xBE1BF1B0, 0x59E9A8D6) },
+	{ JSON__U64(0x1162DEF0, 0x6F79DF73), JSON__U64(0xEDA2EE1C, 0x7064130C) },
+	{ JSON__U64(0x8ADDCB56, 0x45AC2BA8), JSON__U64(0x9485D4D1, 0xC63E8BE7) },
+	{ JSON__U64(0x6D953E2B, 0xD7173692), JSON__U64(0xB9A74A06, 0x37CE2EE1) },
+	{ JSON__U64(0xC8FA8DB6, 0xCCDD0437), JSON__U64(0xE8111C87, 0xC5C1BA99) },
+	{ JSON__U64(0x1D9C9892, 0x400A22A2), JSON__U64(0x910AB1D4, 0xDB9914A0) },
+	{ JSON__U64(0x2503BEB6, 0xD00CAB4B), JSON__U64(0xB54D5E4A, 0x127F59C8) },
+	{ JSON__U64(0x2E44AE64, 0x840FD61D), JSON__U64(0xE2A0B5DC, 0x971F303A) },
+	{ JSON__U64(0x5CEAECFE, 0xD289E5D2), JSON__U64(0x8DA471A9, 0xDE737E24) },
+	{ JSON__U64(0x7425A83E, 0x872C5F47), JSON__U64(0xB10D8E14, 0x56105DAD) },
+	{ JSON__U64(0xD12F124E, 0x28F77719), JSON__U64(0xDD50F199, 0x6B947518) },
+	{ JSON__U64(0x82BD6B70, 0xD99AAA6F), JSON__U64(0x8A5296FF, 0xE33CC92F) },
+	{ JSON__U64(0x636CC64D, 0x1001550B), JSON__U64(0xACE73CBF, 0xDC0BFB7B) },
+	{ JSON__U64(0x3C47F7E0, 0x5401AA4E), JSON__U64(0xD8210BEF, 0xD30EFA5A) },
+	{ JSON__U64(0x65ACFAEC, 0x34810A71), JSON__U64(0x8714A775, 0xE3E95C78) },
+	{ JSON__U64(0x7F1839A7, 0x41A14D0D), JSON__U64(0xA8D9D153, 0x5CE3B396) },
+	{ JSON__U64(0x1EDE4811, 0x1209A050), JSON__U64(0xD31045A8, 0x341CA07C) },
+	{ JSON__U64(0x934AED0A, 0xAB460432), JSON__U64(0x83EA2B89, 0x2091E44D) },
+	{ JSON__U64(0xF81DA84D, 0x5617853F), JSON__U64(0xA4E4B66B, 0x68B65D60) },
+	{ JSON__U64(0x36251260, 0xAB9D668E), JSON__U64(0xCE1DE406, 0x42E3F4B9) },
+	{ JSON__U64(0xC1D72B7C, 0x6B426019), JSON__U64(0x80D2AE83, 0xE9CE78F3) },
+	{ JSON__U64(0xB24CF65B, 0x8612F81F), JSON__U64(0xA1075A24, 0xE4421730) },
+	{ JSON__U64(0xDEE033F2, 0x6797B627), JSON__U64(0xC94930AE, 0x1D529CFC) },
+	{ JSON__U64(0x169840EF, 0x017DA3B1), JSON__U64(0xFB9B7CD9, 0xA4A7443C) },
+	{ JSON__U64(0x8E1F2895, 0x60EE864E), JSON__U64(0x9D412E08, 0x06E88AA5) },
+	{ JSON__U64(0xF1A6F2BA, 0xB92A27E2), JSON__U64(0xC491798A, 0x08A2AD4E) },
+	{ JSON__U64(0xAE10AF69, 0x6774B1DB), JSON__U64(0xF5B5D7EC, 0x8ACB58A2) },
+	{ JSON__U64(0xACCA6DA1, 0xE0A8EF29), JSON__U64(0x9991A6F3, 0xD6BF1765) },
+	{ JSON__U64(0x17FD090A, 0x58D32AF3), JSON__U64(0xBFF610B0, 0xCC6EDD3F) },
+	{ JSON__U64(0xDDFC4B4C, 0xEF07F5B0), JSON__U64(0xEFF394DC, 0xFF8A948E) },
+	{ JSON__U64(0x4ABDAF10, 0x1564F98E), JSON__U64(0x95F83D0A, 0x1FB69CD9) },
+	{ JSON__U64(0x9D6D1AD4, 0x1ABE37F1), JSON__U64(0xBB764C4C, 0xA7A4440F) },
+	{ JSON__U64(0x84C86189, 0x216DC5ED), JSON__U64(0xEA53DF5F, 0xD18D5513) },
+	{ JSON__U64(0x32FD3CF5, 0xB4E49BB4), JSON__U64(0x92746B9B, 0xE2F8552C) },
+	{ JSON__U64(0x3FBC8C33, 0x221DC2A1), JSON__U64(0xB7118682, 0xDBB66A77) },
+	{ JSON__U64(0x0FABAF3F, 0xEAA5334A), JSON__U64(0xE4D5E823, 0x92A40515) },
+	{ JSON__U64(0x29CB4D87, 0xF2A7400E), JSON__U64(0x8F05B116, 0x3BA6832D) },
+	{ JSON__U64(0x743E20E9, 0xEF511012), JSON__U64(0xB2C71D5B, 0xCA9023F8) },
+	{ JSON__U64(0x914DA924, 0x6B255416), JSON__U64(0xDF78E4B2, 0xBD342CF6) },
+	{ JSON__U64(0x1AD089B6, 0xC2F7548E), JSON__U64(0x8BAB8EEF, 0xB6409C1A) },
+	{ JSON__U64(0xA184AC24, 0x73B529B1), JSON__U64(0xAE9672AB, 0xA3D0C320) },
+	{ JSON__U64(0xC9E5D72D, 0x90A2741E), JSON__U64(0xDA3C0F56, 0x8CC4F3E8) },
+	{ JSON__U64(0x7E2FA67C, 0x7A658892), JSON__U64(0x88658996, 0x17FB1871) },
+	{ JSON__U64(0xDDBB901B, 0x98FEEAB7), JSON__U64(0xAA7EEBFB, 0x9DF9DE8D) },
+	{ JSON__U64(0x552A7422, 0x7F3EA565), JSON__U64(0xD51EA6FA, 0x85785631) },
+	{ JSON__U64(0xD53A8895, 0x8F87275F), JSON__U64(0x8533285C, 0x936B35DE) },
+	{ JSON__U64(0x8A892ABA, 0xF368F137), JSON__U64(0xA67FF273, 0xB8460356) },
+	{ JSON__U64(0x2D2B7569, 0xB0432D85), JSON__U64(0xD01FEF10, 0xA657842C) },
+	{ JSON__U64(0x9C3B2962, 0x0E29FC73), JSON__U64(0x8213F56A, 0x67F6B29B) },
+	{ JSON__U64(0x8349F3BA, 0x91B47B8F), JSON__U64(0xA298F2C5, 0x01F45F42) },
+	{ JSON__U64(0x241C70A9, 0x36219A73), JSON__U64(0xCB3F2F76, 0x42717713) },
+	{ JSON__U64(0xED238CD3, 0x83AA0110), JSON__U64(0xFE0EFB53, 0xD30DD4D7) },
+	{ JSON__U64(0xF4363804, 0x324A40AA), JSON__U64(0x9EC95D14, 0x63E8A506) },
+	{ JSON__U64(0xB143C605, 0x3EDCD0D5), JSON__U64(0xC67BB459, 0x7CE2CE48) },
+	{ JSON__U64(0xDD94B786, 0x8E94050A), JSON__U64(0xF81AA16F, 0xDC1B81DA) },
+	{ JSON__U64(0xCA7CF2B4, 0x191C8326), JSON__U64(0x9B10A4E5, 0xE9913128) },
+	{ JSON__U64(0xFD1C2F61, 0x1F63A3F0), JSON__U64(0xC1D4CE1F, 0x63F57D72) },
+	{ JSON__U64(0xBC633B39, 0x673C8CEC), JSON__U64(0xF24A01A7, 0x3CF2DCCF) },
+	{ JSON__U64(0xD5BE0503, 0xE085D813), JSON__U64(0x976E4108, 0x8617CA01) },
+	{ JSON__U64(0x4B2D8644, 0xD8A74E18), JSON__U64(0xBD49D14A, 0xA79DBC82) },
+	{ JSON__U64(0xDDF8E7D6, 0x0ED1219E), JSON__U64(0xEC9C459D, 0x51852BA2) },
+	{ JSON__U64(0xCABB90E5, 0xC942B503), JSON__U64(0x93E1AB82, 0x52F33B45) },
+	{ JSON__U64(0x3D6A751F, 0x3B936243), JSON__U64(0xB8DA1662, 0xE7B00A17) },
+	{ JSON__U64(0x0CC51267, 0x0A783AD4), JSON__U64(0xE7109BFB, 0xA19C0C9D) },
+	{ JSON__U64(0x27FB2B80, 0x668B24C5), JSON__U64(0x906A617D, 0x450187E2) },
+	{ JSON__U64(0xB1F9F660, 0x802DEDF6), JSON__U64(0xB484F9DC, 0x9641E9DA) },
+	{ JSON__U64(0x5E7873F8, 0xA0396973), JSON__U64(0xE1A63853, 0xBBD26451) },
+	{ JSON__U64(0xDB0B487B, 0x6423E1E8), JSON__U64(0x8D07E334, 0x55637EB2) },
+	{ JSON__U64(0x91CE1A9A, 0x3D2CDA62), JSON__U64(0xB049DC01, 0x6ABC5E5F) },
+	{ JSON__U64(0x7641A140, 0xCC7810FB), JSON__U64(0xDC5C5301, 0xC56B75F7) },
+	{ JSON__U64(0xA9E904C8, 0x7FCB0A9D), JSON__U64(0x89B9B3E1, 0x1B6329BA) },
+	{ JSON__U64(0x546345FA, 0x9FBDCD44), JSON__U64(0xAC2820D9, 0x623BF429) },
+	{ JSON__U64(0xA97C1779, 0x47AD4095), JSON__U64(0xD732290F, 0xBACAF133) },
+	{ JSON__U64(0x49ED8EAB, 0xCCCC485D), JSON__U64(0x867F59A9, 0xD4BED6C0) },
+	{ JSON__U64(0x5C68F256, 0xBFFF5A74), JSON__U64(0xA81F3014, 0x49EE8C70) },
+	{ JSON__U64(0x73832EEC, 0x6FFF3111), JSON__U64(0xD226FC19, 0x5C6A2F8C) },
+	{ JSON__U64(0xC831FD53, 0xC5FF7EAB), JSON__U64(0x83585D8F, 0xD9C25DB7) },
+	{ JSON__U64(0xBA3E7CA8, 0xB77F5E55), JSON__U64(0xA42E74F3, 0xD032F525) },
+	{ JSON__U64(0x28CE1BD2, 0xE55F35EB), JSON__U64(0xCD3A1230, 0xC43FB26F) },
+	{ JSON__U64(0x7980D163, 0xCF5B81B3), JSON__U64(0x80444B5E, 0x7AA7CF85) },
+	{ JSON__U64(0xD7E105BC, 0xC332621F), JSON__U64(0xA0555E36, 0x1951C366) },
+	{ JSON__U64(0x8DD9472B, 0xF3FEFAA7), JSON__U64(0xC86AB5C3, 0x9FA63440) },
+	{ JSON__U64(0xB14F98F6, 0xF0FEB951), JSON__U64(0xFA856334, 0x878FC150) },
+	{ JSON__U64(0x6ED1BF9A, 0x569F33D3), JSON__U64(0x9C935E00, 0xD4B9D8D2) },
+	{ JSON__U64(0x0A862F80, 0xEC4700C8), JSON__U64(0xC3B83581, 0x09E84F07) },
+	{ JSON__U64(0xCD27BB61, 0x2758C0FA), JSON__U64(0xF4A642E1, 0x4C6262C8) },
+	{ JSON__U64(0x8038D51C, 0xB897789C), JSON__U64(0x98E7E9CC, 0xCFBD7DBD) },
+	{ JSON__U64(0xE0470A63, 0xE6BD56C3), JSON__U64(0xBF21E440, 0x03ACDD2C) },
+	{ JSON__U64(0x1858CCFC, 0xE06CAC74), JSON__U64(0xEEEA5D50, 0x04981478) },
+	{ JSON__U64(0x0F37801E, 0x0C43EBC8), JSON__U64(0x95527A52, 0x02DF0CCB) },
+	{ JSON__U64(0xD3056025, 0x8F54E6BA), JSON__U64(0xBAA718E6, 0x8396CFFD) },
+	{ JSON__U64(0x47C6B82E, 0xF32A2069), JSON__U64(0xE950DF20, 0x247C83FD) },
+	{ JSON__U64(0x4CDC331D, 0x57FA5441), JSON__U64(0x91D28B74, 0x16CDD27E) },
+	{ JSON__U64(0xE0133FE4, 0xADF8E952), JSON__U64(0xB6472E51, 0x1C81471D) },
+	{ JSON__U64(0x58180FDD, 0xD97723A6), JSON__U64(0xE3D8F9E5, 0x63A198E5) },
+	{ JSON__U64(0x570F09EA, 0xA7EA7648), JSON__U64(0x8E679C2F, 0x5E44FF8F) },
+	{ JSON__U64(0x2CD2CC65, 0x51E513DA), JSON__U64(0xB201833B, 0x35D63F73) },
+	{ JSON__U64(0xF8077F7E, 0xA65E58D1), JSON__U64(0xDE81E40A, 0x034BCF4F) },
+	{ JSON__U64(0xFB04AFAF, 0x27FAF782), JSON__U64(0x8B112E86, 0x420F6191) },
+	{ JSON__U64(0x79C5DB9A, 0xF1F9B563), JSON__U64(0xADD57A27, 0xD29339F6) },
+	{ JSON__U64(0x18375281, 0xAE7822BC), JSON__U64(0xD94AD8B1, 0xC7380874) },
+	{ JSON__U64(0x8F229391, 0x0D0B15B5), JSON__U64(0x87CEC76F, 0x1C830548) },
+	{ JSON__U64(0xB2EB3875, 0x504DDB22), JSON__U64(0xA9C2794A, 0xE3A3C69A) },
+	{ JSON__U64(0x5FA60692, 0xA46151EB), JSON__U64(0xD433179D, 0x9C8CB841) },
+	{ JSON__U64(0xDBC7C41B, 0xA6BCD333), JSON__U64(0x849FEEC2, 0x81D7F328) },
+	{ JSON__U64(0x12B9B522, 0x906C0800), JSON__U64(0xA5C7EA73, 0x224DEFF3) },
+	{ JSON__U64(0xD768226B, 0x34870A00), JSON__U64(0xCF39E50F, 0xEAE16BEF) },
+	{ JSON__U64(0xE6A11583, 0x00D46640), JSON__U64(0x81842F29, 0xF2CCE375) },
+	{ JSON__U64(0x60495AE3, 0xC1097FD0), JSON__U64(0xA1E53AF4, 0x6F801C53) },
+	{ JSON__U64(0x385BB19C, 0xB14BDFC4), JSON__U64(0xCA5E89B1, 0x8B602368) },
+	{ JSON__U64(0x46729E03, 0xDD9ED7B5), JSON__U64(0xFCF62C1D, 0xEE382C42) },
+	{ JSON__U64(0x6C07A2C2, 0x6A8346D1), JSON__U64(0x9E19DB92, 0xB4E31BA9) },
+	{ JSON__U64(0xC7098B73, 0x05241885), JSON__U64(0xC5A05277, 0x621BE293) },
+	{ JSON__U64(0xB8CBEE4F, 0xC66D1EA7), JSON__U64(0xF7086715, 0x3AA2DB38) },
+	{ JSON__U64(0x737F74F1, 0xDC043328), JSON__U64(0x9A65406D, 0x44A5C903) },
+	{ JSON__U64(0x505F522E, 0x53053FF2), JSON__U64(0xC0FE9088, 0x95CF3B44) },
+	{ JSON__U64(0x647726B9, 0xE7C68FEF), JSON__U64(0xF13E34AA, 0xBB430A15) },
+	{ JSON__U64(0x5ECA7834, 0x30DC19F5), JSON__U64(0x96C6E0EA, 0xB509E64D) },
+	{ JSON__U64(0xB67D1641, 0x3D132072), JSON__U64(0xBC789925, 0x624C5FE0) },
+	{ JSON__U64(0xE41C5BD1, 0x8C57E88F), JSON__U64(0xEB96BF6E, 0xBADF77D8) },
+	{ JSON__U64(0x8E91B962, 0xF7B6F159), JSON__U64(0x933E37A5, 0x34CBAAE7) },
+	{ JSON__U64(0x723627BB, 0xB5A4ADB0), JSON__U64(0xB80DC58E, 0x81FE95A1) },
+	{ JSON__U64(0xCEC3B1AA, 0xA30DD91C), JSON__U64(0xE61136F2, 0x227E3B09) },
+	{ JSON__U64(0x213A4F0A, 0xA5E8A7B1), JSON__U64(0x8FCAC257, 0x558EE4E6) },
+	{ JSON__U64(0xA988E2CD, 0x4F62D19D), JSON__U64(0xB3BD72ED, 0x2AF29E1F) },
+	{ JSON__U64(0x93EB1B80, 0xA33B8605), JSON__U64(0xE0ACCFA8, 0x75AF45A7) },
+	{ JSON__U64(0xBC72F130, 0x660533C3), JSON__U64(0x8C6C01C9, 0x498D8B88) },
+	{ JSON__U64(0xEB8FAD7C, 0x7F8680B4), JSON__U64(0xAF87023B, 0x9BF0EE6A) },
+	{ JSON__U64(0xA67398DB, 0x9F6820E1), JSON__U64(0xDB68C2CA, 0x82ED2A05) },
+	{ JSON__U64(0x88083F89, 0x43A1148C), JSON__U64(0x892179BE, 0x91D43A43) },
+	{ JSON__U64(0x6A0A4F6B, 0x948959B0), JSON__U64(0xAB69D82E, 0x364948D4) },
+	{ JSON__U64(0x848CE346, 0x79ABB01C), JSON__U64(0xD6444E39, 0xC3DB9B09) },
+	{ JSON__U64(0xF2D80E0C, 0x0C0B4E11), JSON__U64(0x85EAB0E4, 0x1A6940E5) },
+	{ JSON__U64(0x6F8E118F, 0x0F0E2195), JSON__U64(0xA7655D1D, 0x2103911F) },
+	{ JSON__U64(0x4B7195F2, 0xD2D1A9FB), JSON__U64(0xD13EB464, 0x69447567) },
+};
+
+#define JSON__POW10_MIN -348
+#define JSON__POW10_MAX 347
+
+static const double json__pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*	Full product of two 64 bit numbers, returns the low half.  */
+static json_uint64_t json__mul128(json_uint64_t a, json_uint64_t b, json_uint64_t* hi)
+{
+#if defined(__SIZEOF_INT128__)
+	__extension__ unsigned __int128 r = (unsigned __int128)a * b;
+	*hi = (json_uint64_t)(r >> 64);
+	return (json_uint64_t)r;
+#elif defined(_MSC_VER) && defined(_M_X64)
+	return _umul128(a, b, hi);
+#else
+	json_uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+	json_uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+	json_uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+	json_uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFF) + (p10 & 0xFFFFFFFF);
+
+	*hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+	return (mid << 32) | (p00 & 0xFFFFFFFF);
+#endif
+}
+
+static int json__clz(json_uint64_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_clzll(value);
+#else
+	int n = 0;
+
+	if (!(value >> 32)) { n += 32; value <<= 32; }
+	if (!(value >> 48)) { n += 16; value <<= 16; }
+	if (!(value >> 56)) { n += 8; value <<= 8; }
+	if (!(value >> 60)) { n += 4; value <<= 4; }
+	if (!(value >> 62)) { n += 2; value <<= 2; }
+	if (!(value >> 63)) { n += 1; }
+	return n;
+#endif
+}
+
+static double json__bits_to_double(json_uint64_t bits)
+{
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+/*	Eisel-Lemire: man * 10^exp10 correctly rounded. Returns 0 if the result can not be decided
+	this way.  */
+static int json__eisel_lemire(json_uint64_t man, int exp10, int neg, double* out)
+{
+	const json_uint64_t* pow;
+	json_uint64_t x_hi, x_lo, y_hi, y_lo, mantissa, exp2, msb;
+	int clz;
+
+	if (man == 0)
+	{
+		*out = neg ? -0.0 : 0.0;
+		return 1;
+	}
+
+	if (exp10 < JSON__POW10_MIN || exp10 > JSON__POW10_MAX)
+		return 0;
+
+	pow = json__pow10_128[exp10 - JSON__POW10_MIN];
+
+	/* normalize, then floor(exp10 * log2(10)) gives the binary exponent */
+
+	clz = json__clz(man);
+	man <<= clz;
+	exp2 = (json_uint64_t)((exp10 >= 0 ? (217706 * exp10) >> 16 : -((-217706 * exp10 + 65535) >> 16))
+		+ 64 + 1023) - (json_uint64_t)clz;
+
+	x_lo = json__mul128(man, pow[1], &x_hi);
+
+	/* the upper 64 bits of the power were not precise enough, use all 128 */
+
+	if ((x_hi & 0x1FF) == 0x1FF && x_lo + man < man)
+	{
+		json_uint64_t merged_hi = x_hi, merged_lo;
+
+		y_lo = json__mul128(man, pow[0], &y_hi);
+		merged_lo = x_lo + y_hi;
+
+		if (merged_lo < x_lo)
+			merged_hi++;
+
+		if ((merged_hi & 0x1FF) == 0x1FF && merged_lo + 1 == 0 && y_lo + man < man)
+			return 0;
+
+		x_hi = merged_hi;
+		x_lo = merged_lo;
+	}
+
+	/* shift to 54 bits, halfway cases can not be decided */
+
+	msb = x_hi >> 63;
+	mantissa = x_hi >> (msb + 9);
+	exp2 -= 1 ^ msb;
+
+	if (x_lo == 0 && (x_hi & 0x1FF) == 0 && (mantissa & 3) == 1)
+		return 0;
+
+	/* round to 53 bits */
+
+	mantissa += mantissa & 1;
+	mantissa >>= 1;
+
+	if (mantissa >> 53)
+	{
+		mantissa >>= 1;
+		exp2++;
+	}
+
+	/* subnormals, infinity */
+
+	if (exp2 - 1 >= 0x7FF - 1)
+		return 0;
+
+	*out = json__bits_to_double((exp2 << 52) | (mantissa & JSON__U64(0x000FFFFF, 0xFFFFFFFF))
+		| (neg ? JSON__U64(0x80000000, 0) : 0));
+	return 1;
+}
+
+/*	Correctly rounded conversion with the C library, the decimal point is adapted to the locale.  */
+static double json__strtod(const char* begin, const char* end)
+{
+	char buffer[64], * number = buffer, * dot;
+	size_t len = (size_t)(end - begin);
+	double value;
+
+	if (len >= sizeof(buffer) && (number = malloc(len + 1)) == NULL)
+		return 0.0;
+
+	memcpy(number, begin, len);
+	number[len] = 0;
+
+	if ((dot = memchr(number, '.', len)) != NULL)
+		*dot = *localeconv()->decimal_point;
+
+	value = strtod(number, NULL);
+
+	if (number != buffer)
+		free(number);
+
+	return value;
+}
+
+/*	Scan a JSON number without reading past end. Integers are stored in *integer, as two's
+	complement if negative, decimals in *real. Returns a 'json__number_result'.  */
+static int json__scan_number(const char** p, const char* end, double* real,
+	json_uint64_t* integer)
+{
+	const char* c = *p;
+	json_uint64_t man = 0;
+	long exp10 = 0;
+	int neg = 0, truncated = 0, is_integer = 1;
+
+	if (c != end && *c == '-')
+	{
+		neg = 1;
+		c++;
+	}
+
+	if (c == end || (unsigned)(*c - '0') > 9)
+		return JSON__NUMBER_INVALID;
+
+	/* integer part, no leading zeros. Digits that do not fit 64 bits only count the exponent */
+
+	if (*c == '0')
+		c++;
+	else
+	{
+		for (; c != end && (unsigned)(*c - '0') <= 9; c++)
+		{
+			unsigned int digit = (unsigned int)(*c - '0');
+
+			if (man < JSON__U64(0x19999999, 0x99999999)
+				|| (man == JSON__U64(0x19999999, 0x99999999) && digit <= 5))
+				man = man * 10 + digit;
+			else
+			{
+				exp10++;
+				truncated |= digit != 0;
+			}
+		}
+	}
+
+	/* fraction */
+
+	if (c != end && *c == '.')
+	{
+		is_integer = 0;
+		c++;
+
+		if (c == end || (unsigned)(*c - '0') > 9)
+			return JSON__NUMBER_INVALID;
+
+		for (; c != end && (unsigned)(*c - '0') <= 9; c++)
+		{
+			unsigned int digit = (unsigned int)(*c - '0');
+
+			if (man < JSON__U64(0x19999999, 0x99999999))
+			{
+				man = man * 10 + digit;
+				exp10--;
+			}
+			else
+				truncated |= digit != 0;
+		}
+	}
+
+	/* exponent */
+
+	if (c != end && (*c == 'e' || *c == 'E'))
+	{
+		long exponent = 0;
+		int exp_neg = 0;
+
+		is_integer = 0;
+		c++;
+
+		if (c != end && (*c == '+' || *c == '-'))
+			exp_neg = *c++ == '-';
+
+		if (c == end || (unsigned)(*c - '0') > 9)
+			return JSON__NUMBER_INVALID;
+
+		for (; c != end && (unsigned)(*c - '0') <= 9; c++)
+		{
+			if (exponent < 100000)
+				exponent = exponent * 10 + (*c - '0');
+		}
+
+		exp10 += exp_neg ? -exponent : exponent;
+	}
+
+	/* integers, -0 is kept as a double */
+
+	if (is_integer && !truncated && exp10 == 0 && !(neg && man == 0))
+	{
+		*p = c;
+
+		if (!neg)
+		{
+			*integer = man;
+			return man >> 63 ? JSON__NUMBER_UINT : JSON__NUMBER_INT;
+		}
+
+		if (man <= JSON__U64(0x80000000, 0))
+		{
+			*integer = 0 - man;
+			return JSON__NUMBER_INT;
+		}
+	}
+
+	/* Clinger's fast path, both operands and the result are exact */
+
+	if (!truncated && man <= JSON__U64(0x00200000, 0) && exp10 >= -22 && exp10 <= 22)
+	{
+		double value = (double)man;
+
+		value = exp10 < 0 ? value / json__pow10[-exp10] : value * json__pow10[exp10];
+		*real = neg ? -value : value;
+	}
+	else if (exp10 < JSON__POW10_MIN - 19)
+		*real = neg ? -0.0 : 0.0;
+	else
+	{
+		double low, high;
+
+		/* a truncated mantissa lies between man and man + 1, both must round alike */
+
+		if (json__eisel_lemire(man, (int)exp10, neg, &low) && (!truncated
+			|| (json__eisel_lemire(man + 1, (int)exp10, neg, &high) && low == high)))
+			*real = low;
+		else
+			*real = json__strtod(*p, c);
+	}
+
+	*p = c;
+	return JSON__NUMBER_REAL;
+}
+
+/*	Doubles are printed with Grisu2: the shortest digits (in nearly all cases) that read back to
+	the same double. It works on 64 bit floating point numbers with a power of ten taken from the
+	table above.  */
+
+typedef struct json__diyfp_t
+{
+	json_uint64_t f;
+	int e;
+
+} json__diyfp_t;
+
+static json__diyfp_t json__diyfp(json_uint64_t f, int e)
+{
+	json__diyfp_t x;
+	x.f = f;
+	x.e = e;
+	return x;
+}
+
+/*	Product rounded to 64 bits.  */
+static json__diyfp_t json__diyfp_mul(json__diyfp_t x, json__diyfp_t y)
+{
+	json_uint64_t hi, lo = json__mul128(x.f, y.f, &hi);
+	return json__diyfp(hi + (lo >> 63), x.e + y.e + 64);
+}
+
+static json__diyfp_t json__diyfp_normalize(json__diyfp_t x)
+{
+	int shift = json__clz(x.f);
+	return json__diyfp(x.f << shift, x.e - shift);
+}
+
+/*	10^k rounded to 64 bits, with k chosen so that the product with a number of binary exponent
+	e has an exponent in [-60, -32]. The integral part of the scaled value then fits 32 bits.  */
+static json__diyfp_t json__cached_pow10(int e, int* k)
+{
+	int f = -60 - e - 1;
+	const json_uint64_t* pow;
+
+	*k = f * 78913 / (1 << 18) + (f > 0);
+	pow = json__pow10_128[*k - JSON__POW10_MIN];
+
+	return json__diyfp(pow[1] + (pow[0] >> 63), ((*k * 217706) >> 16) - 63);
+}
+
+/*	Step the last digit down while that moves closer to w and stays inside the interval.  */
+static void json__grisu_round(char* digits, int len, json_uint64_t dist, json_uint64_t delta,
+	json_uint64_t rest, json_uint64_t ten_k)
+{
+	while (rest < dist && delta - rest >= ten_k
+		&& (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+	{
+		digits[len - 1]--;
+		rest += ten_k;
+	}
+}
+
+/*	Generate the digits of w with low < w < high, all scaled to the same exponent. Returns the
+	number of digits, *exp10 is adjusted by the power of ten of the last digit.  */
+static int json__grisu_digits(char* digits, int* exp10, json__diyfp_t low, json__diyfp_t w,
+	json__diyfp_t high)
+{
+	static const unsigned long pow10[] = {
+		1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+	};
+	json_uint64_t delta = high.f - low.f;
+	json_uint64_t dist = high.f - w.f;
+	json_uint64_t one = (json_uint64_t)1 << -high.e;
+	unsigned long p1 = (unsigned long)(high.f >> -high.e);
+	json_uint64_t p2 = high.f & (one - 1);
+	int len = 0, n = 10, m = 0;
+
+	while (n > 1 && p1 < pow10[n - 1])
+		n--;
+
+	/* integral part */
+
+	while (n > 0)
+	{
+		json_uint64_t rest;
+
+		n--;
+		digits[len++] = (char)('0' + p1 / pow10[n]);
+		p1 %= pow10[n];
+
+		rest = ((json_uint64_t)p1 << -high.e) + p2;
+
+		if (rest <= delta)
+		{
+			*exp10 += n;
+			json__grisu_round(digits, len, dist, delta, rest, (json_uint64_t)pow10[n] << -high.e);
+			return len;
+		}
+	}
+
+	/* fractional part */
+
+	do
+	{
+		p2 *= 10;
+		digits[len++] = (char)('0' + (p2 >> -high.e));
+		p2 &= one - 1;
+		delta *= 10;
+		dist *= 10;
+		m++;
+	} while (p2 > delta);
+
+	*exp10 -= m;
+	json__grisu_round(digits, len, dist, delta, p2, one);
+	return len;
+}
+
+/*	Check if man * 10^exp10 parses as value.  */
+static int json__reads_back(json_uint64_t man, int exp10, double value)
+{
+	double back;
+
+	if (man <= JSON__U64(0x00200000, 0) && exp10 >= -22 && exp10 <= 22)
+		back = exp10 < 0 ? (double)man / json__pow10[-exp10] : (double)man * json__pow10[exp10];
+	else if (!json__eisel_lemire(man, exp10, 0, &back))
+		return 0;
+
+	return back == value;
+}
+
+/*	Grisu2 works on a slightly narrowed interval and can return one digit more than needed. Check
+	if the nearest shorter number still reads back as value.  */
+static int json__grisu_shorten(double value, char* digits, int len, int* exp10)
+{
+	json_uint64_t man = 0, candidate;
+	int i, up = digits[len - 1] >= '5';
+
+	for (i = 0; i < len - 1; i++)
+		man = man * 10 + (unsigned int)(digits[i] - '0');
+
+	candidate = man + up;
+
+	if (!json__reads_back(candidate, *exp10 + 1, value))
+	{
+		candidate = man + !up;
+
+		if (!json__reads_back(candidate, *exp10 + 1, value))
+			return len;
+	}
+
+	for (*exp10 += 1; candidate % 10 == 0; candidate /= 10)
+		*exp10 += 1;
+
+	for (len = 0, man = candidate; man; man /= 10)
+		len++;
+
+	for (i = len; i > 0; candidate /= 10)
+		digits[--i] = (char)('0' + candidate % 10);
+
+	return len;
+}
+
+/*	Shortest digits of a finite positive double, value = digits * 10^exp10.  */
+static int json__grisu2(double value, char* digits, int* exp10)
+{
+	json_uint64_t bits, f;
+	json__diyfp_t v, low, high, pow;
+	int e, k, len;
+
+	memcpy(&bits, &value, sizeof(bits));
+	f = bits & JSON__U64(0x000FFFFF, 0xFFFFFFFF);
+	e = (int)(bits >> 52);
+
+	v = e ? json__diyfp(f | JSON__U64(0x00100000, 0), e - 1075) : json__diyfp(f, -1074);
+
+	/* the boundaries halfway to the neighbours, the lower one is closer at a power of two */
+
+	high = json__diyfp_normalize(json__diyfp((v.f << 1) + 1, v.e - 1));
+
+	if (f == 0 && e > 1)
+		low = json__diyfp((v.f << 2) - 1, v.e - 2);
+	else
+		low = json__diyfp((v.f << 1) - 1, v.e - 1);
+
+	low = json__diyfp(low.f << (low.e - high.e), high.e);
+	v = json__diyfp_normalize(v);
+
+	pow = json__cached_pow10(high.e, &k);
+	v = json__diyfp_mul(v, pow);
+	low = json__diyfp_mul(low, pow);
+	high = json__diyfp_mul(high, pow);
+
+	/* the products are off by up to one unit, shrink the interval to stay on the safe side */
+
+	low.f++;
+	high.f--;
+
+	*exp10 = -k;
+	len = json__grisu_digits(digits, exp10, low, v, high);
+
+	return len < 15 ? len : json__grisu_shorten(value, digits, len, exp10);
+}
+
+/**************************************************************************************************
+	JSON Parser  */
+
+enum json_parse_state
+{
+	JSON_START = 1 << 0,
+	JSON_OBJECT_START = 1 << 1,
+	JSON_OBJECT_KEY = 1 << 2,
+	JSON_OBJECT_COLON = 1 << 3,
+	JSON_OBJECT_VAL = 1 << 4,
+	JSON_OBJECT_NEXT = 1 << 5,
+
+	JSON_ARRAY_START = 1 << 6,
+	JSON_ARRAY_VAL = 1 << 7,
+	JSON_ARRAY_NEXT = 1 << 8,
+};
+
+/*	Map any character to JSON token.  */
+char json__token_type[256];
+
+/*	A state mask for every JSON token. Used to tell if a token is valid or out of place.  */
+short json_state_mask[JSON_TOKEN_COUNT];
+
+/*	Initialize lookup tables used by the parser.  */
+static void json__tables_init()
+{
+	int value_states = JSON_OBJECT_VAL | JSON_ARRAY_START | JSON_ARRAY_VAL;
+	int i;
+
+	/* initialize json type map */
+
+	memset(json__token_type, JSON_NONE, 256);
+
+	json__token_type['{'] = JSON_OBJECT;
+	json__token_type['}'] = JSON_SCOPE_END;
+	json__token_type['['] = JSON_ARRAY;
+	json__token_type[']'] = JSON_SCOPE_END;
+	json__token_type['"'] = JSON_STRING;
+	json__token_type[':'] = JSON_COLON;
+	json__token_type[','] = JSON_COMMA;
+	json__token_type['-'] = JSON_NUMBER;
+
+	for (i = 0; i < 10; i++)
+		json__token_type['0' + i] = JSON_NUMBER;
+
+	json__token_type['t'] = JSON_TRUE;
+	json__token_type['f'] = JSON_FALSE;
+	json__token_type['n'] = JSON_NULL;
+
+	/* initialize json task map */
+
+	json_state_mask[JSON_OBJECT] = JSON_START | value_states;
+	json_state_mask[JSON_ARRAY] = JSON_START | value_states;
+	json_state_mask[JSON_STRING] = JSON_START | JSON_OBJECT_START | JSON_OBJECT_KEY | value_states;
+	json_state_mask[JSON_NUMBER] = JSON_START | value_states;
+	json_state_mask[JSON_TRUE] = JSON_START | value_states;
+	json_state_mask[JSON_FALSE] = JSON_START | value_states;
+	json_state_mask[JSON_NULL] = JSON_START | value_states;
+	json_state_mask[JSON_NONE] = 0;
+	json_state_mask[JSON_COLON] = JSON_OBJECT_COLON;
+	json_state_mask[JSON_COMMA] = JSON_OBJECT_NEXT | JSON_ARRAY_NEXT;
+	json_state_mask[JSON_SCOPE_END] = JSON_OBJECT_START | JSON_OBJECT_NEXT
+		| JSON_ARRAY_START | JSON_ARRAY_NEXT;
+
+	/* initialize character classes and pick the stage one classifier and escape scanner */
+
+	json__class[' '] = JSON__CLASS_WS;
+	json__class['\t'] = JSON__CLASS_WS;
+	json__class['\n'] = JSON__CLASS_WS;
+	json__class['\r'] = JSON__CLASS_WS;
+	json__class['{'] = JSON__CLASS_OP;
+	json__class['}'] = JSON__CLASS_OP;
+	json__class['['] = JSON__CLASS_OP;
+	json__class[']'] = JSON__CLASS_OP;
+	json__class[':'] = JSON__CLASS_OP;
+	json__class[','] = JSON__CLASS_OP;
+	json__class['"'] = JSON__CLASS_QUOTE;
+	json__class['\\'] = JSON__CLASS_BS;
+
+#if defined(JSON__SSE2)
+	json__classify = json__classify_sse2;
+#endif
+#if defined(JSON__AVX2)
+	if (json__has_avx2())
+	{
+		json__classify = json__classify_avx2;
+		json__escape_scan = json__escape_avx2;
+	}
+#endif
+
+	/* the once publishes the seed together with the tables */
+
+	if (!json__seed_ready)
+		json__seed_random();
+}
+
+/*	Initialize the lookup tables and the hash seed, safe to call from any thread  */
+static void json__tables()
+{
+	static json__once_t once = JSON__ONCE_INIT;
+	json__once(&once, json__tables_init);
+}
+
+/*	A scalar must be followed by whitespace, a structural character or the end of input.  */
+static int json__scalar_end(const char* c, const char* end)
+{
+	return c == end || (json__class[(unsigned char)*c] & (JSON__CLASS_WS | JSON__CLASS_OP));
+}
+
+/*	Find the closing quote of the string starting at c. A quote preceded by an odd number of
+	backslashes is escaped.  */
+static const char* json__string_end(const char* c, const char* end)
+{
+	const char* head = c + 1;
+
+	for (c = head; (c = memchr(c, '"', (size_t)(end - c))) != NULL; c++)
+	{
+		const char* bs = c;
+
+		while (bs > head && bs[-1] == '\\')
+			bs--;
+
+		if (((c - bs) & 1) == 0)
+			break;
+	}
+
+	return c;
+}
+
+static int json__hex(const char* c)
+{
+	int i, value = 0;
+
+	for (i = 0; i < 4; i++)
+	{
+		int digit = c[i];
+
+		if (digit >= '0' && digit <= '9')
+			digit -= '0';
+		else if ((digit | 0x20) >= 'a' && (digit | 0x20) <= 'f')
+			digit = (digit | 0x20) - 'a' + 10;
+		else
+			return -1;
+
+		value = (value << 4) | digit;
+	}
+
+	return value;
+}
+
+/*	Check the escape sequences and control characters of a string without decoding it, so events
+	only report valid strings. Surrogates must be paired like in 'json__unescape()'.  */
+static int json__string_valid(const char* c, const char* end)
+{
+	while ((c = json__escape_scan(c, end)) != end)
+	{
+		long cp, low;
+
+		if (*c != '\\' || end - c < 2)
+			return 0;
+
+		switch (c[1])
+		{
+		case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+			c += 2;
+			continue;
+
+		case 'u':
+			if (end - c < 6 || (cp = json__hex(c + 2)) < 0)
+				return 0;
+
+			c += 6;
+
+			if (cp >= 0xD800 && cp < 0xDC00)
+			{
+				if (end - c < 6 || c[0] != '\\' || c[1] != 'u'
+					|| (low = json__hex(c + 2)) < 0xDC00 || low > 0xDFFF)
+					return 0;
+
+				c += 6;
+			}
+			else if (cp >= 0xDC00 && cp < 0xE000)
+				return 0;
+
+			continue;
+		}
+
+		return 0;
+	}
+
+	return 1;
+}
+
+/*	A token that touches the end of a chunk is complete if more input can not change it: a
+	structural character, a string with its closing quote or a scalar followed by a delimiter.  */
+static int json__token_complete(const char* c, const char* end)
+{
+	switch (json__token_type[(unsigned char)*c])
+	{
+	case JSON_OBJECT:
+	case JSON_ARRAY:
+	case JSON_SCOPE_END:
+	case JSON_COLON:
+	case JSON_COMMA:
+		return 1;
+	case JSON_STRING:
+		return json__string_end(c, end) != NULL;
+	}
+
+	while (c != end && !(json__class[(unsigned char)*c] & (JSON__CLASS_WS | JSON__CLASS_OP)))
+		c++;
+
+	return c != end;
+}
+
+/*	Parse all tokens of text that are known to be complete. Unless there is no more input the last
+	token is kept if it may continue in the next chunk. Returns the offset of the first unparsed
+	token.  */
+static size_t json__parser_run(json_parser_t* parser, const char* text, size_t len, int last)
+{
+	const json_handler_t* h = parser->handler;
+	void* ctx = parser->ctx;
+	unsigned char* scope = parser->scope;
+	int depth = parser->depth;
+
+	int state = parser->state;
+	const char* end = text + len;
+	const char* base = text;
+	size_t window = JSON__WINDOW;
+
+	/* parse string to events, one window of tokens at a time */
+
+	while (base < end)
+	{
+		size_t wlen = (size_t)(end - base);
+		int i, n, count;
+
+		if (wlen > window)
+			wlen = window;
+
+		if (parser->index_cap < wlen)
+		{
+			free(parser->index);
+			parser->index_cap = wlen;
+			parser->index = malloc(sizeof(unsigned int) * parser->index_cap);
+
+			if (parser->index == NULL)
+			{
+				parser->index_cap = 0;
+				goto error;
+			}
+		}
+
+		n = json__index(base, wlen, parser->index);
+
+		/* The last token of a window may be cut off, it is parsed with the next window. If it is
+		   the only token the window is too small. */
+
+		if (base + wlen < end || n == 0)
+			count = n - 1;
+		else if (last || json__token_complete(base + parser->index[n - 1], end))
+			count = n;
+		else
+			count = n - 1;
+
+		if (count <= 0)
+		{
+			if (n == 0)
+			{
+				base += wlen;
+				continue;
+			}
+
+			if (base + wlen == end)
+				break;
+
+			window *= 2;
+			continue;
+		}
+
+		for (i = 0; i < count; i++)
+		{
+			const char* c = base + parser->index[i];
+			int type = json__token_type[(unsigned char)*c];
+
+			if (!(state & json_state_mask[type]))
+				goto error;
+
+			/* emit event */
+
+			switch (type)
+			{
+			case JSON_OBJECT:
+			case JSON_ARRAY:
+				if (depth == JSON_MAX_DEPTH - 1)
+					goto error;
+
+				if (type == JSON_OBJECT ? h->object_begin && !h->object_begin(ctx)
+					: h->array_begin && !h->array_begin(ctx))
+					goto error;
+
+				scope[++depth] = (unsigned char)type;
+				state = type == JSON_OBJECT ? JSON_OBJECT_START : JSON_ARRAY_START;
+				continue;
+
+			case JSON_STRING:
+			{
+				const char* close = json__string_end(c, end);
+
+				if (close == NULL || !json__string_valid(c + 1, close))
+					goto error;
+
+				if (state & (JSON_OBJECT_START | JSON_OBJECT_KEY))
+				{
+					if (h->key && !h->key(ctx, c + 1, (size_t)(close - c - 1)))
+						goto error;
+
+					state = JSON_OBJECT_COLON;
+					continue;
+				}
+
+				if (h->string && !h->string(ctx, c + 1, (size_t)(close - c - 1)))
+					goto error;
+
+				break;
+			}
+
+			case JSON_NUMBER:
+			{
+				double num;
+				json_uint64_t integer;
+				int result = json__scan_number(&c, end, &num, &integer);
+
+				if (result == JSON__NUMBER_INVALID || !json__scalar_end(c, end))
+					goto error;
+
+				if (result == JSON__NUMBER_INT && h->integer)
+				{
+					if (!h->integer(ctx, (json_int64_t)integer))
+						goto error;
+				}
+				else if (result == JSON__NUMBER_UINT && h->uinteger)
+				{
+					if (!h->uinteger(ctx, integer))
+						goto error;
+				}
+				else
+				{
+					if (result == JSON__NUMBER_INT)
+						num = (double)(json_int64_t)integer;
+					else if (result == JSON__NUMBER_UINT)
+						num = (double)integer;
+
+					if (h->number && !h->number(ctx, num))
+						goto error;
+				}
+
+				break;
+			}
+
+			case JSON_TRUE:
+			case JSON_FALSE:
+			{
+				int value = type == JSON_TRUE;
+				size_t size = value ? 4 : 5;
+
+				if ((size_t)(end - c) < size || strncmp(c, value ? "true" : "false", size) != 0
+					|| !json__scalar_end(c + size, end))
+					goto error;
+
+				if (h->boolean && !h->boolean(ctx, value))
+					goto error;
+
+				break;
+			}
+
+			case JSON_NULL:
+				if (end - c < 4 || strncmp(c, "null", 4) != 0 || !json__scalar_end(c + 4, end))
+					goto error;
+
+				if (h->null && !h->null(ctx))
+					goto error;
+
+				break;
+
+			case JSON_COLON:
+				state = JSON_OBJECT_VAL;
+				continue;
+
+			case JSON_COMMA:
+				state = scope[depth] == JSON_OBJECT ? JSON_OBJECT_KEY : JSON_ARRAY_VAL;
+				continue;
+
+			case JSON_SCOPE_END:
+				if ((*c == '}') != (scope[depth] == JSON_OBJECT))
+					goto error;
+
+				if (*c == '}' ? h->object_end && !h->object_end(ctx)
+					: h->array_end && !h->array_end(ctx))
+					goto error;
+
+				depth--;
+				break;
+			}
+
+			/* a value is complete, nothing may follow the root value */
+
+			state = depth < 0 ? 0 : scope[depth] == JSON_OBJECT ? JSON_OBJECT_NEXT : JSON_ARRAY_NEXT;
+		}
+
+		if (count == n)
+		{
+			base = end;
+			break;
+		}
+
+		base += parser->index[count];
+	}
+
+	parser->depth = depth;
+	parser->state = state;
+	return (size_t)(base - text);
+
+error:
+	parser->depth = depth;
+	parser->state = state;
+	parser->error = 1;
+	return len;
+}
+
+/**************************************************************************************************
+	JSON Parser DOM  */
+
+/*	The DOM is built by an event handler of the parser.  */
+
+static int json__utf8(char* out, long cp)
+{
+	if (cp < 0x80)
+	{
+		out[0] = (char)cp;
+		return 1;
+	}
+	if (cp < 0x800)
+	{
+		out[0] = (char)(0xC0 | (cp >> 6));
+		out[1] = (char)(0x80 | (cp & 0x3F));
+		return 2;
+	}
+	if (cp < 0x10000)
+	{
+		out[0] = (char)(0xE0 | (cp >> 12));
+		out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = (char)(0x80 | (cp & 0x3F));
+		return 3;
+	}
+
+	out[0] = (char)(0xF0 | (cp >> 18));
+	out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+	out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+	out[3] = (char)(0x80 | (cp & 0x3F));
+	return 4;
+}
+
+/*	Decode the escape sequences of src into dst, dst may be src. The result is never longer than
+	src. Returns the decoded length or -1 if an escape sequence is invalid.  */
+static long json__unescape(char* dst, const char* src, size_t len)
+{
+	const char* end = src + len;
+	char* out = dst;
+
+	while (src < end)
+	{
+		const char* stop = json__escape_scan(src, end);
+		size_t run = (size_t)(stop - src);
+		long cp, low;
+
+		if (out != src)
+			memmove(out, src, run);
+
+		out += run;
+		src += run;
+
+		if (src == end)
+			break;
+
+		/* control characters must be escaped */
+
+		if (*src != '\\' || end - src < 2)
+			return -1;
+
+		switch (src[1])
+		{
+		case '"': *out++ = '"'; break;
+		case '\\': *out++ = '\\'; break;
+		case '/': *out++ = '/'; break;
+		case 'b': *out++ = '\b'; break;
+		case 'f': *out++ = '\f'; break;
+		case 'n': *out++ = '\n'; break;
+		case 'r': *out++ = '\r'; break;
+		case 't': *out++ = '\t'; break;
+
+		case 'u':
+			if (end - src < 6 || (cp = json__hex(src + 2)) < 0)
+				return -1;
+
+			src += 6;
+
+			/* surrogate pairs are combined, unpaired surrogates are invalid */
+
+			if (cp >= 0xD800 && cp < 0xDC00)
+			{
+				if (end - src < 6 || src[0] != '\\' || src[1] != 'u'
+					|| (low = json__hex(src + 2)) < 0xDC00 || low > 0xDFFF)
+					return -1;
+
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+				src += 6;
+			}
+			else if (cp >= 0xDC00 && cp < 0xE000)
+				return -1;
+
+			out += json__utf8(out, cp);
+			continue;
+
+		default:
+			return -1;
+		}
+
+		src += 2;
+	}
+
+	return (long)(out - dst);
+}
+
+long json_unescape(char* dst, const char* src, size_t len)
+{
+	return json__unescape(dst, src, len);
+}
+
+/*	Copy and decode a string.  */
+static json__string_t json__string_slice(const char* str, size_t len, int pad,
+	json_arena_t* arena)
+{
+	json__string_t string = { NULL, 0, 0, NULL };
+	long decoded;
+
+	string.cap = pad ? json__next_capacity((int)len + 1) : (int)len + 1;
+	string.data = json__alloc(arena, string.cap);
+	string.arena = arena;
+
+	if (string.data == NULL || (decoded = json__unescape(string.data, str, len)) < 0)
+	{
+		json__dealloc(arena, string.data);
+		string.data = NULL;
+		string.cap = 0;
+		return string;
+	}
+
+	string.len = (int)decoded;
+	string.data[decoded] = 0;
+	return string;
+}
+
+/*	Decode a string in place and terminate it, it remains in the input buffer.  */
+static json__string_t json__string_insitu(const char* str, size_t len, json_arena_t* arena)
+{
+	json__string_t string = { NULL, 0, 0, NULL };
+	long decoded = json__unescape((char*)str, str, len);
+
+	string.arena = arena;
+
+	if (decoded < 0)
+		return string;
+
+	string.data = (char*)str;
+	string.data[decoded] = 0;
+	string.len = (int)decoded;
+	return string;
+}
+
+static int json__dom_add(json__dom_t* dom, json_t val)
+{
+	json_t* parent = dom->stack + dom->depth;
+
+	if (JSON__TYPE(val) == JSON_NONE)
+		return 0;
+
+	if (dom->depth < 0)
+		dom->stack[0] = val;
+	else if (JSON__TYPE(*parent) == JSON_OBJECT)
+	{
+		json__object_set(JSON__OBJ(*parent), dom->key, val, 0);
+		dom->key = NULL;
+	}
+	else
+		json_array_push(*parent, val);
+
+	return 1;
+}
+
+static int json__dom_object_begin(void* ctx)
+{
+	json__dom_t* dom = ctx;
+	json_t val = json__object_node(dom->arena);
+
+	if (!json__dom_add(dom, val))
+		return 0;
+
+	if (dom->insitu)
+		JSON__OBJ(val)->flags |= JSON__BORROWED_KEYS;
+
+	dom->stack[++dom->depth] = val;
+	return 1;
+}
+
+static int json__dom_array_begin(void* ctx)
+{
+	json__dom_t* dom = ctx;
+	json_t val = json__array_node(dom->arena);
+
+	if (!json__dom_add(dom, val))
+		return 0;
+
+	dom->stack[++dom->depth] = val;
+	return 1;
+}
+
+static int json__dom_end(void* ctx)
+{
+	((json__dom_t*)ctx)->depth--;
+	return 1;
+}
+
+/*	Distinct keys interned per document  */
+#define JSON__INTERN_MAX 0x1000
+
+/*	Decode a key and return its interned copy. The table holds one reference to every key, it
+	stops growing at JSON__INTERN_MAX keys, later keys are not interned. Raw keys from binary
+	input are passed with escaped set to 0.  */
+static const char* json__dom_intern(json__dom_t* dom, const char* str, size_t len, int escaped)
+{
+	char* key = NULL;
+	unsigned int hash;
+	int mask, idx;
+
+	/* keys with escapes are decoded first, the others are looked up as they are */
+
+	if (escaped && json__escape_scan(str, str + len) != str + len)
+	{
+		long decoded;
+
+		key = json__key_alloc(dom->arena, len);
+
+		if (key == NULL || (decoded = json__unescape(key, str, len)) < 0)
+		{
+			if (key)
+				json__key_release(dom->arena, key);
+
+			return NULL;
+		}
+
+		key[decoded] = 0;
+		str = key;
+		len = (size_t)decoded;
+	}
+
+	hash = json__key_hash(str, len);
+	mask = dom->keys_cap - 1;
+
+	for (idx = (int)(hash & mask); dom->keys_cap && dom->keys[idx]; idx = (idx + 1) & mask)
+	{
+		const char* other = dom->keys[idx];
+
+		if (JSON__KEY(other)->hash == hash && JSON__KEY(other)->len == (int)len
+			&& memcmp(other, str, len) == 0)
+		{
+			if (key)
+				json__key_release(dom->arena, key);
+
+			JSON__KEY(other)->refs++;
+			return other;
+		}
+	}
+
+	if (key)
+	{
+		JSON__KEY(key)->hash = hash;
+		JSON__KEY(key)->len = (int)len;
+	}
+	else if ((key = json__key_new(dom->arena, str, len, hash)) == NULL)
+		return NULL;
+
+	if (dom->keys_len >= JSON__INTERN_MAX)
+		return key;
+
+	/* keep the table at most half full */
+
+	if ((dom->keys_len + 1) * 2 > dom->keys_cap)
+	{
+		int cap = dom->keys_cap ? dom->keys_cap * 2 : 64, i;
+		const char** keys = calloc((size_t)cap, sizeof(const char*));
+
+		if (keys == NULL)
+			return key;
+
+		for (i = 0; i < dom->keys_cap; i++)
+		{
+			if (dom->keys[i])
+			{
+				for (idx = (int)(JSON__KEY(dom->keys[i])->hash & (cap - 1)); keys[idx];
+					idx = (idx + 1) & (cap - 1));
+
+				keys[idx] = dom->keys[i];
+			}
+		}
+
+		free((void*)dom->keys);
+		dom->keys = keys;
+		dom->keys_cap = cap;
+		mask = cap - 1;
+
+		for (idx = (int)(hash & mask); keys[idx]; idx = (idx + 1) & mask);
+	}
+
+	dom->keys[idx] = key;
+	dom->keys_len++;
+	JSON__KEY(key)->refs++;
+	return key;
+}
+
+static int json__dom_key(void* ctx, const char* str, size_t len)
+{
+	json__dom_t* dom = ctx;
+
+	if (dom->insitu)
+		dom->key = json__string_insitu(str, len, dom->arena).data;
+	else
+		dom->key = json__dom_intern(dom, str, len, 1);
+
+	return dom->key != NULL;
+}
+
+static int json__dom_string(void* ctx, const char* str, size_t len)
+{
+	json__dom_t* dom = ctx;
+	json__string_t* string;
+	long decoded;
+
+	/* short strings are decoded behind their header */
+
+	if (!dom->insitu && len <= JSON__STRING_INLINE)
+	{
+		if ((string = json__string_alloc(dom->arena, len)) == NULL)
+			return 0;
+
+		if ((decoded = json__unescape(string->data, str, len)) < 0)
+		{
+			json__dealloc(dom->arena, string);
+			return 0;
+		}
+
+		string->data[decoded] = 0;
+		string->len = (int)decoded;
+		return json__dom_add(dom, json__node(JSON_STRING, string));
+	}
+
+	string = json__alloc(dom->arena, sizeof(json__string_t));
+
+	if (string == NULL)
+		return 0;
+
+	if (dom->insitu)
+		*string = json__string_insitu(str, len, dom->arena);
+	else
+		*string = json__string_slice(str, len, 1, dom->arena);
+
+	if (string->data == NULL)
+	{
+		json__dealloc(dom->arena, string);
+		return 0;
+	}
+
+	return json__dom_add(dom, json__node(JSON_STRING, string));
+}
+
+static int json__dom_number(void* ctx, double value)
+{
+	return json__dom_add(ctx, json_number(value));
+}
+
+#define JSON__EXACT_INT ((json_int64_t)1 << 53)
+
+/*	Integers a double represents exactly are stored as double.  */
+static int json__dom_integer(void* ctx, json_int64_t value)
+{
+	json__dom_t* dom = ctx;
+
+	if (value >= -JSON__EXACT_INT && value <= JSON__EXACT_INT)
+		return json__dom_add(dom, json_number((double)value));
+
+	return json__dom_add(dom, json__integer_node(dom->arena, JSON_NUMBER_INT,
+		(json_uint64_t)value));
+}
+
+static int json__dom_uinteger(void* ctx, json_uint64_t value)
+{
+	json__dom_t* dom = ctx;
+	return json__dom_add(dom, json__integer_node(dom->arena, JSON_NUMBER_UINT, value));
+}
+
+static int json__dom_boolean(void* ctx, int value)
+{
+	return json__dom_add(ctx, json_bool(value));
+}
+
+static int json__dom_null(void* ctx)
+{
+	return json__dom_add(ctx, json_null());
+}
+
+static const json_handler_t json__dom_handler = {
+	json__dom_object_begin,
+	json__dom_end,
+	json__dom_array_begin,
+	json__dom_end,
+	json__dom_key,
+	json__dom_string,
+	json__dom_number,
+	json__dom_integer,
+	json__dom_uinteger,
+	json__dom_boolean,
+	json__dom_null,
+};
+
+/**************************************************************************************************
+	JSON Parser API  */
+
+static void json__parser_init(json_parser_t* parser, const json_handler_t* handler, void* ctx)
+{
+	parser->handler = handler;
+	parser->ctx = ctx;
+	parser->depth = -1;
+	parser->state = JSON_START;
+	parser->error = 0;
+	parser->buffer = NULL;
+	parser->len = 0;
+	parser->cap = 0;
+	parser->index = NULL;
+	parser->index_cap = 0;
+
+	/* initialize lookup tables */
+
+	json__tables();
+}
+
+static void json__dom_init(json_parser_t* parser, json_arena_t* arena)
+{
+	json__parser_init(parser, &json__dom_handler, &parser->dom);
+
+	parser->dom.stack[0] = json__const_node(JSON_NONE);
+	parser->dom.depth = -1;
+	parser->dom.insitu = 0;
+	parser->dom.key = NULL;
+	parser->dom.keys = NULL;
+	parser->dom.keys_len = 0;
+	parser->dom.keys_cap = 0;
+	parser->dom.arena = arena;
+}
+
+/*	Take the document out of the parser. A document that is invalid or incomplete is freed.  */
+static json_t json__dom_root(json_parser_t* parser)
+{
+	json_t root = parser->dom.stack[0];
+
+	parser->dom.stack[0] = json__const_node(JSON_NONE);
+
+	if (parser->error || parser->state != 0)
+	{
+		json_free(root);
+		root = json__const_node(JSON_NONE);
+	}
+
+	return root;
+}
+
+/*	Release the interned keys, the table is kept for the next document.  */
+static void json__dom_forget(json__dom_t* dom)
+{
+	int i;
+
+	for (i = 0; i < dom->keys_cap; i++)
+	{
+		if (dom->keys[i])
+		{
+			json__key_release(dom->arena, dom->keys[i]);
+			dom->keys[i] = NULL;
+		}
+	}
+
+	dom->keys_len = 0;
+}
+
+static void json__parser_release(json_parser_t* parser)
+{
+	free(parser->buffer);
+	free(parser->index);
+
+	parser->buffer = NULL;
+	parser->index = NULL;
+	parser->len = 0;
+	parser->cap = 0;
+	parser->index_cap = 0;
+
+	if (parser->handler == &json__dom_handler)
+	{
+		if (parser->dom.key && !parser->dom.insitu)
+			json__key_release(parser->dom.arena, parser->dom.key);
+
+		json__dom_forget(&parser->dom);
+		free((void*)parser->dom.keys);
+		parser->dom.key = NULL;
+		parser->dom.keys = NULL;
+		parser->dom.keys_len = 0;
+		parser->dom.keys_cap = 0;
+	}
+}
+
+json_parser_t* json_parser_new(json_arena_t* arena)
+{
+	json_parser_t* parser = malloc(sizeof(json_parser_t));
+
+	if (parser)
+		json__dom_init(parser, arena);
+
+	return parser;
+}
+
+json_parser_t* json_parser_new_sax(const json_handler_t* handler, void* ctx)
+{
+	json_parser_t* parser = malloc(sizeof(json_parser_t));
+
+	if (parser)
+		json__parser_init(parser, handler, ctx);
+
+	return parser;
+}
+
+/*	Append to the unfinished token  */
+static int json__parser_append(json_parser_t* parser, const char* data, size_t len)
+{
+	if (len == 0)
+		return 1;
+
+	if (parser->cap < parser->len + len)
+	{
+		size_t cap = parser->cap ? parser->cap : 256;
+		char* buffer;
+
+		while (cap < parser->len + len)
+			cap *= 2;
+
+		if ((buffer = realloc(parser->buffer, cap)) == NULL)
+		{
+			parser->error = 1;
+			return 0;
+		}
+
+		parser->buffer = buffer;
+		parser->cap = cap;
+	}
+
+	memcpy(parser->buffer + parser->len, data, len);
+	parser->len += len;
+	return 1;
+}
+
+/*	Bytes of chunk up to the end of the unfinished token: the closing quote of a string or the
+	delimiter behind a scalar. 0 if the token does not end in chunk.  */
+static size_t json__parser_pending(json_parser_t* parser, const char* chunk, size_t len)
+{
+	const char* c = parser->buffer;
+	const char* end = parser->buffer + parser->len;
+	size_t i, tail = 0;
+
+	while (c != end && (json__class[(unsigned char)*c] & JSON__CLASS_WS))
+		c++;
+
+	if (c == end || *c != '"')
+	{
+		for (i = 0; i < len; i++)
+		{
+			if (json__class[(unsigned char)chunk[i]] & (JSON__CLASS_WS | JSON__CLASS_OP))
+				return i + 1;
+		}
+
+		return 0;
+	}
+
+	/* backslashes at the end of the buffer escape the first character of chunk */
+
+	while (end - tail - 1 > c && *(end - tail - 1) == '\\')
+		tail++;
+
+	for (c = chunk; (c = memchr(c, '"', (size_t)(chunk + len - c))) != NULL; c++)
+	{
+		const char* bs = c;
+
+		while (bs > chunk && bs[-1] == '\\')
+			bs--;
+
+		if ((((size_t)(c - bs) + (bs == chunk ? tail : 0)) & 1) == 0)
+			return (size_t)(c - chunk) + 1;
+	}
+
+	return 0;
+}
+
+int json_parser_feed(json_parser_t* parser, const char* chunk, size_t len)
+{
+	size_t done;
+
+	if (parser->error)
+		return 0;
+
+	if (parser->len)
+	{
+		/* complete the unfinished token of the previous chunk, only its end is copied */
+
+		size_t pending = json__parser_pending(parser, chunk, len);
+
+		if (pending == 0)
+			return json__parser_append(parser, chunk, len);
+
+		if (!json__parser_append(parser, chunk, pending))
+			return 0;
+
+		chunk += pending;
+		len -= pending;
+
+		done = json__parser_run(parser, parser->buffer, parser->len, 0);
+		parser->len -= done;
+		memmove(parser->buffer, parser->buffer + done, parser->len);
+
+		if (parser->error)
+			return 0;
+
+		if (parser->len)
+			return json__parser_append(parser, chunk, len);
+	}
+
+	/* parse the chunk in place, only an unfinished token at its end is copied */
+
+	done = json__parser_run(parser, chunk, len, 0);
+
+	if (parser->error)
+		return 0;
+
+	return json__parser_append(parser, chunk + done, len - done);
+}
+
+json_t json_parser_finish(json_parser_t* parser)
+{
+	json_t root = json__const_node(JSON_NONE);
+
+	if (!parser->error && parser->len)
+		json__parser_run(parser, parser->buffer, parser->len, 1);
+
+	/* the document must be complete */
+
+	if (parser->state != 0)
+		parser->error = 1;
+
+	json__parser_release(parser);
+
+	if (parser->handler == &json__dom_handler)
+		root = json__dom_root(parser);
+
+	return root;
+}
+
+void json_parser_free(json_parser_t* parser)
+{
+	if (parser == NULL)
+		return;
+
+	if (parser->handler == &json__dom_handler)
+		json_free(parser->dom.stack[0]);
+
+	json__parser_release(parser);
+	free(parser);
+}
+
+int json_parse_sax(const char* text, size_t len, const json_handler_t* handler, void* ctx)
+{
+	json_parser_t parser;
+
+	json__parser_init(&parser, handler, ctx);
+	json__parser_run(&parser, text, len, 1);
+	json__parser_release(&parser);
+
+	return !parser.error && parser.state == 0;
+}
+
+static json_t json__parse(const char* text, size_t len, json_arena_t* arena)
+{
+	json_parser_t parser;
+
+	json__dom_init(&parser, arena);
+	json__parser_run(&parser, text, len, 1);
+	json__parser_release(&parser);
+
+	return json__dom_root(&parser);
+}
+
+/*	Parse another document with the buffers and interned keys of the last one.  */
+static json_t json__parse_next(json_parser_t* parser, const char* text, size_t len)
+{
+	json__dom_t* dom = &parser->dom;
+	json_t root;
+
+	parser->depth = -1;
+	parser->state = JSON_START;
+	parser->error = 0;
+	dom->depth = -1;
+
+	json__parser_run(parser, text, len, 1);
+	root = json__dom_root(parser);
+
+	/* key of an unfinished member */
+
+	if (dom->key)
+	{
+		json__key_release(dom->arena, dom->key);
+		dom->key = NULL;
+	}
+
+	return root;
+}
+
+/*	convert string to json_t  */
+json_t json_parse(const char* text)
+{
+	return json__parse(text, strlen(text), NULL);
+}
+
+json_t json_parse_arena(const char* text, json_arena_t* arena)
+{
+	return json__parse(text, strlen(text), arena);
+}
+
+json_t json_parse_insitu(char* buffer, size_t len, json_arena_t* arena)
+{
+	json_parser_t parser;
+
+	json__dom_init(&parser, arena);
+	parser.dom.insitu = 1;
+	json__parser_run(&parser, buffer, len, 1);
+	json__parser_release(&parser);
+
+	return json__dom_root(&parser);
+}
+
+json_t json_parse_n(const char* text, size_t len)
+{
+	return json__parse(text, len, NULL);
+}
+
+/**************************************************************************************************
+	JSON File  */
+
+/*	Files are mapped copy-on-write. Parsing only reads the mapping, in-place parsing makes private
+	copies of the pages it writes to and the file never changes.  */
+
+json_file_t* json_file_map(const char* path)
+{
+	json_file_t* file = malloc(sizeof(json_file_t));
+
+#if defined(_WIN32)
+	HANDLE handle, mapping;
+	LARGE_INTEGER size;
+
+	if (file == NULL)
+		return NULL;
+
+	handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+	if (handle == INVALID_HANDLE_VALUE)
+	{
+		free(file);
+		return NULL;
+	}
+
+	file->data = NULL;
+	file->len = 0;
+
+	if (!GetFileSizeEx(handle, &size) || (json_uint64_t)size.QuadPart > (size_t)-1)
+	{
+		CloseHandle(handle);
+		free(file);
+		return NULL;
+	}
+
+	file->len = (size_t)size.QuadPart;
+
+	/* the view stays valid after the handles are closed */
+
+	if (file->len)
+	{
+		mapping = CreateFileMappingA(handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+
+		if (mapping)
+		{
+			file->data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+			CloseHandle(mapping);
+		}
+	}
+
+	CloseHandle(handle);
+#else
+	struct stat info;
+	int fd;
+
+	if (file == NULL)
+		return NULL;
+
+	if ((fd = open(path, O_RDONLY)) < 0)
+	{
+		free(file);
+		return NULL;
+	}
+
+	file->data = NULL;
+	file->len = 0;
+
+	if (fstat(fd, &info) != 0 || (json_uint64_t)info.st_size > (size_t)-1)
+	{
+		close(fd);
+		free(file);
+		return NULL;
+	}
+
+	file->len = (size_t)info.st_size;
+
+	if (file->len)
+	{
+		void* data = mmap(NULL, file->len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+		if (data != MAP_FAILED)
+			file->data = data;
+#if defined(POSIX_MADV_SEQUENTIAL)
+		if (file->data)
+			posix_madvise(file->data, file->len, POSIX_MADV_SEQUENTIAL);
+#endif
+	}
+
+	close(fd);
+#endif
+
+	if (file->len && file->data == NULL)
+	{
+		free(file);
+		return NULL;
+	}
+
+	return file;
+}
+
+void json_file_free(json_file_t* file)
+{
+	if (file == NULL)
+		return;
+
+#if defined(_WIN32)
+	if (file->data)
+		UnmapViewOfFile(file->data);
+#else
+	if (file->data)
+		munmap(file->data, file->len);
+#endif
+
+	free(file);
+}
+
+json_t json_parse_file(const char* path)
+{
+	json_file_t* file = json_file_map(path);
+	json_t value;
+
+	if (file == NULL)
+		return json__const_node(JSON_NONE);
+
+	value = json__parse(file->len ? file->data : "", file->len, NULL);
+	json_file_free(file);
+	return value;
+}
+
+/**************************************************************************************************
+	JSON Lines  */
+
+/*	The text is cut into batches at line ends. Batch i is parsed into slot i % slot_count, every
+	slot has its own arena. Workers and the calling thread take the next batch whose slot is free,
+	the calling thread passes the records of the slots to the callback in input order and frees
+	the slot when they are consumed. Memory use is bounded by the number of slots.  */
+
+#define JSON__LINES_BATCH_MIN 0x10000
+#define JSON__LINES_BATCH_MAX 0x400000
+
+typedef struct json__lines_slot_t
+{
+	json_arena_t* arena;
+	json_t* records;
+	size_t* lines;
+	int len;
+	int cap;
+	size_t line_count;
+	long batch;
+	int done;
+	int error;
+
+} json__lines_slot_t;
+
+typedef struct json__lines_t
+{
+	const char* text;
+	size_t len;
+	size_t batch_size;
+	long batches;
+	long next;
+	int stop;
+
+	json__lines_slot_t* slots;
+	int slot_count;
+	int use_arena;
+
+	json__mutex_t mutex;
+	json__cond_t cond;
+
+} json__lines_t;
+
+/*	Start of a batch, behind the first line end at or after its nominal start  */
+static size_t json__lines_boundary(const json__lines_t* lines, long batch)
+{
+	size_t at = (size_t)batch * lines->batch_size;
+	const char* nl;
+
+	if (batch == 0)
+		return 0;
+
+	if (at >= lines->len)
+		return lines->len;
+
+	nl = memchr(lines->text + at - 1, '\n', lines->len - at + 1);
+	return nl ? (size_t)(nl - lines->text) + 1 : lines->len;
+}
+
+static int json__lines_push(json__lines_slot_t* slot, json_t record, size_t line)
+{
+	if (slot->len == slot->cap)
+	{
+		int cap = slot->cap ? slot->cap * 2 : 256;
+		json_t* records = realloc(slot->records, sizeof(json_t) * (size_t)cap);
+		size_t* lines;
+
+		if (records == NULL)
+			return 0;
+
+		slot->records = records;
+
+		if ((lines = realloc(slot->lines, sizeof(size_t) * (size_t)cap)) == NULL)
+			return 0;
+
+		slot->lines = lines;
+		slot->cap = cap;
+	}
+
+	slot->records[slot->len] = record;
+	slot->lines[slot->len++] = line;
+	return 1;
+}
+
+/*	Parse the records of the slot's batch. Blank lines are skipped.  */
+static void json__lines_parse(json__lines_t* lines, json__lines_slot_t* slot,
+	json_parser_t* parser)
+{
+	const char* c = lines->text + json__lines_boundary(lines, slot->batch);
+	const char* end = lines->text + json__lines_boundary(lines, slot->batch + 1);
+
+	slot->len = 0;
+	slot->line_count = 0;
+	slot->error = 0;
+
+	if (slot->arena)
+		json_arena_reset(slot->arena);
+
+	parser->dom.arena = slot->arena;
+
+	while (c < end)
+	{
+		const char* nl = memchr(c, '\n', (size_t)(end - c));
+		const char* eol = nl ? nl : end;
+		const char* first = c;
+
+		while (first < eol && (*first == ' ' || *first == '\t' || *first == '\r'))
+			first++;
+
+		if (first < eol && !json__lines_push(slot,
+			json__parse_next(parser, first, (size_t)(eol - first)), slot->line_count))
+		{
+			slot->error = 1;
+			break;
+		}
+
+		if (nl)
+			slot->line_count++;
+
+		c = eol + 1;
+	}
+
+	/* keys are only shared within a batch, once it is passed on no other thread touches them */
+
+	json__dom_forget(&parser->dom);
+}
+
+/*	Take the next batch if its slot is free and parse it. Called with the mutex locked.  */
+static int json__lines_work(json__lines_t* lines, json_parser_t* parser)
+{
+	json__lines_slot_t* slot;
+
+	if (lines->stop || lines->next >= lines->batches)
+		return 0;
+
+	slot = lines->slots + lines->next % lines->slot_count;
+
+	if (slot->batch != -1)
+		return 0;
+
+	slot->batch = lines->next++;
+	json__mutex_unlock(&lines->mutex);
+
+	json__lines_parse(lines, slot, parser);
+
+	json__mutex_lock(&lines->mutex);
+	slot->done = 1;
+	json__cond_wake(&lines->cond);
+	return 1;
+}
+
+JSON__THREAD_FN(json__lines_worker, arg)
+{
+	json__lines_t* lines = arg;
+	json_parser_t parser;
+
+	json__dom_init(&parser, NULL);
+	json__mutex_lock(&lines->mutex);
+
+	while (!lines->stop && lines->next < lines->batches)
+	{
+		if (!json__lines_work(lines, &parser))
+			json__cond_wait(&lines->cond, &lines->mutex);
+	}
+
+	json__mutex_unlock(&lines->mutex);
+	json__parser_release(&parser);
+	JSON__THREAD_RETURN;
+}
+
+/*	Records of the heap are owned by the callback, only those that were never passed are freed  */
+static void json__lines_free_slot(json__lines_t* lines, json__lines_slot_t* slot, int from)
+{
+	if (!lines->use_arena)
+	{
+		for (; from < slot->len; from++)
+			json_free(slot->records[from]);
+	}
+
+	slot->len = 0;
+}
+
+static int json__parse_lines(const char* text, size_t len, int threads, int use_arena,
+	json_record_fn record, void* ctx)
+{
+	json__lines_t lines;
+	json__thread_t workers[64];
+	json_parser_t parser;
+	size_t base = 0;
+	long batch;
+	int i, started = 0, valid = 1, stop = 0;
+
+	json__tables();
+
+	if (threads <= 0)
+		threads = json__cpu_count();
+
+	if (threads > (int)(sizeof(workers) / sizeof(workers[0])) + 1)
+		threads = (int)(sizeof(workers) / sizeof(workers[0])) + 1;
+
+	/* a few batches per thread so that threads finishing early find more work */
+
+	lines.text = text;
+	lines.len = len;
+	lines.batch_size = len / ((size_t)threads * 8);
+
+	if (lines.batch_size < JSON__LINES_BATCH_MIN)
+		lines.batch_size = JSON__LINES_BATCH_MIN;
+
+	if (lines.batch_size > JSON__LINES_BATCH_MAX)
+		lines.batch_size = JSON__LINES_BATCH_MAX;
+
+	lines.batches = (long)((len + lines.batch_size - 1) / lines.batch_size);
+	lines.next = 0;
+	lines.stop = 0;
+	lines.use_arena = use_arena;
+
+	if (threads > lines.batches)
+		threads = lines.batches > 0 ? (int)lines.batches : 1;
+
+	lines.slot_count = threads * 2;
+	lines.slots = calloc((size_t)lines.slot_count, sizeof(json__lines_slot_t));
+
+	if (lines.slots == NULL)
+		return 0;
+
+	for (i = 0; i < lines.slot_count; i++)
+	{
+		lines.slots[i].batch = -1;
+
+		if (use_arena && (lines.slots[i].arena = json_arena_new(0)) == NULL)
+			stop = 1;
+	}
+
+	json__mutex_init(&lines.mutex);
+	json__cond_init(&lines.cond);
+	json__dom_init(&parser, NULL);
+
+	if (!stop)
+	{
+		for (started = 0; started < threads - 1; started++)
+		{
+			if (!json__thread_start(workers + started, json__lines_worker, &lines))
+				break;
+		}
+	}
+
+	/* consume in input order, help parsing while the next batch is not done */
+
+	for (batch = 0; !stop && batch < lines.batches; batch++)
+	{
+		json__lines_slot_t* slot = lines.slots + batch % lines.slot_count;
+
+		json__mutex_lock(&lines.mutex);
+
+		while (slot->batch != batch || !slot->done)
+		{
+			if (!json__lines_work(&lines, &parser))
+				json__cond_wait(&lines.cond, &lines.mutex);
+		}
+
+		json__mutex_unlock(&lines.mutex);
+
+		stop = slot->error;
+
+		for (i = 0; !stop && i < slot->len; i++)
+		{
+			if (JSON__TYPE(slot->records[i]) == JSON_NONE)
+				valid = 0;
+
+			stop = !record(ctx, slot->records[i], base + slot->lines[i]);
+		}
+
+		json__lines_free_slot(&lines, slot, i);
+		base += slot->line_count;
+
+		json__mutex_lock(&lines.mutex);
+		slot->batch = -1;
+		slot->done = 0;
+		lines.stop = stop;
+		json__cond_wake(&lines.cond);
+		json__mutex_unlock(&lines.mutex);
+	}
+
+	for (i = 0; i < started; i++)
+		json__thread_join(workers + i);
+
+	/* batches parsed ahead of a stop */
+
+	for (i = 0; i < lines.slot_count; i++)
+	{
+		json__lines_free_slot(&lines, lines.slots + i, 0);
+		json_arena_free(lines.slots[i].arena);
+		free(lines.slots[i].records);
+		free(lines.slots[i].lines);
+	}
+
+	json__parser_release(&parser);
+	json__cond_free(&lines.cond);
+	json__mutex_free(&lines.mutex);
+	free(lines.slots);
+	return valid && !stop;
+}
+
+int json_parse_lines(const char* text, size_t len, int threads, json_record_fn record, void* ctx)
+{
+	return json__parse_lines(text, len, threads, 1, record, ctx);
+}
+
+static int json__lines_append(void* ctx, json_t record, size_t line)
+{
+	(void)line;
+
+	if (JSON__TYPE(record) == JSON_NONE)
+		return 0;
+
+	json_array_push(*(json_t*)ctx, record);
+	return 1;
+}
+
+json_t json_parse_lines_array(const char* text, size_t len, int threads)
+{
+	json_t array = json_array();
+
+	if (JSON__TYPE(array) == JSON_NONE)
+		return array;
+
+	if (!json__parse_lines(text, len, threads, 0, json__lines_append, &array))
+	{
+		json_free(array);
+		return json__const_node(JSON_NONE);
+	}
+
+	return array;
+}
+
+/**************************************************************************************************
+	JSON Tape  */
+
+/*	A word holds the tag in the upper 8 bits and a payload in the lower 56 bits. The tags of
+	values are their json types.
+
+	- Object, array: count of members or elements (saturated at JSON__TAPE_COUNT) in bits 32 -
+	  55 and the index behind the end word in bits 0 - 31
+	- End: index of the begin word
+	- String, key: offset into the string buffer, the string is prefixed with its length
+	- Number: num_type, the next word holds the value  */
+
+enum json__tape_tags
+{
+	JSON__TAPE_KEY = JSON_NONE + 1,
+	JSON__TAPE_END,
+};
+
+#define JSON__TAPE_WORD(tag, payload) (((json_uint64_t)(tag) << 56) | (json_uint64_t)(payload))
+#define JSON__TAPE_TAG(word) ((int)((word) >> 56))
+#define JSON__TAPE_PAYLOAD(word) ((word) & JSON__U64(0xFFFFFF, 0xFFFFFFFF))
+#define JSON__TAPE_COUNT 0xFFFFFF
+
+typedef struct json__tape_builder_t
+{
+	json_tape_t* tape;
+	size_t begin[JSON_MAX_DEPTH];
+	int count[JSON_MAX_DEPTH];
+	int depth;
+
+} json__tape_builder_t;
+
+static int json__tape_reserve(json_tape_t* tape, size_t words)
+{
+	if (tape->len + words > tape->cap)
+	{
+		size_t cap = tape->cap * 2;
+		json_uint64_t* data;
+
+		if ((data = realloc(tape->words, cap * sizeof(json_uint64_t))) == NULL)
+			return 0;
+
+		tape->words = data;
+		tape->cap = cap;
+	}
+
+	return 1;
+}
+
+static int json__tape_push(json__tape_builder_t* builder, int tag, json_uint64_t payload)
+{
+	json_tape_t* tape = builder->tape;
+
+	if (!json__tape_reserve(tape, 1))
+		return 0;
+
+	tape->words[tape->len++] = JSON__TAPE_WORD(tag, payload);
+	return 1;
+}
+
+/*	Count a value or key of the innermost container  */
+static int json__tape_value(json__tape_builder_t* builder, int tag, json_uint64_t payload)
+{
+	if (builder->depth >= 0 && (tag == JSON__TAPE_KEY
+			|| JSON__TAPE_TAG(builder->tape->words[builder->begin[builder->depth]]) == JSON_ARRAY))
+		builder->count[builder->depth]++;
+
+	return json__tape_push(builder, tag, payload);
+}
+
+static int json__tape_number(json__tape_builder_t* builder, int num_type, json_uint64_t bits)
+{
+	json_tape_t* tape = builder->tape;
+
+	if (!json__tape_value(builder, JSON_NUMBER, (json_uint64_t)num_type)
+		|| !json__tape_reserve(tape, 1))
+		return 0;
+
+	tape->words[tape->len++] = bits;
+	return 1;
+}
+
+static int json__tape_begin(json__tape_builder_t* builder, int tag)
+{
+	if (!json__tape_value(builder, tag, 0))
+		return 0;
+
+	builder->depth++;
+	builder->begin[builder->depth] = builder->tape->len - 1;
+	builder->count[builder->depth] = 0;
+	return 1;
+}
+
+static int json__tape_end(void* ctx)
+{
+	json__tape_builder_t* builder = ctx;
+	json_tape_t* tape = builder->tape;
+	size_t begin = builder->begin[builder->depth];
+	int count = builder->count[builder->depth];
+
+	/* jump offsets are 32 bit */
+
+	if (tape->len + 1 > 0xFFFFFFFFu || !json__tape_push(builder, JSON__TAPE_END, begin))
+		return 0;
+
+	if (count > JSON__TAPE_COUNT)
+		count = JSON__TAPE_COUNT;
+
+	tape->words[begin] = JSON__TAPE_WORD(JSON__TAPE_TAG(tape->words[begin]),
+		((json_uint64_t)count << 32) | tape->len);
+
+	builder->depth--;
+	return 1;
+}
+
+static int json__tape_object_begin(void* ctx)
+{
+	return json__tape_begin(ctx, JSON_OBJECT);
+}
+
+static int json__tape_array_begin(void* ctx)
+{
+	return json__tape_begin(ctx, JSON_ARRAY);
+}
+
+/*	Decode a string into the string buffer, behind its length  */
+static int json__tape_text(json__tape_builder_t* builder, int tag, const char* str, size_t len)
+{
+	json_tape_t* tape = builder->tape;
+	size_t offset = tape->strings_len;
+	unsigned int length;
+	long decoded;
+
+	if (len > 0x7FFFFFFF)
+		return 0;
+
+	if (offset + sizeof(length) + len + 1 > tape->strings_cap)
+	{
+		size_t cap = tape->strings_cap * 2;
+		char* strings;
+
+		while (offset + sizeof(length) + len + 1 > cap)
+			cap *= 2;
+
+		if ((strings = realloc(tape->strings, cap)) == NULL)
+			return 0;
+
+		tape->strings = strings;
+		tape->strings_cap = cap;
+	}
+
+	if ((decoded = json__unescape(tape->strings + offset + sizeof(length), str, len)) < 0)
+		return 0;
+
+	length = (unsigned int)decoded;
+	memcpy(tape->strings + offset, &length, sizeof(length));
+	tape->strings[offset + sizeof(length) + length] = 0;
+	tape->strings_len = offset + sizeof(length) + length + 1;
+
+	return json__tape_value(builder, tag, offset);
+}
+
+static int json__tape_key(void* ctx, const char* str, size_t len)
+{
+	return json__tape_text(ctx, JSON__TAPE_KEY, str, len);
+}
+
+static int json__tape_string(void* ctx, const char* str, size_t len)
+{
+	return json__tape_text(ctx, JSON_STRING, str, len);
+}
+
+static int json__tape_real(void* ctx, double value)
+{
+	json_uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return json__tape_number(ctx, JSON_NUMBER_REAL, bits);
+}
+
+/*	Same representation as the DOM, integers a double represents exactly are stored as double  */
+static int json__tape_integer(void* ctx, json_int64_t value)
+{
+	if (value >= -JSON__EXACT_INT && value <= JSON__EXACT_INT)
+		return json__tape_real(ctx, (double)value);
+
+	return json__tape_number(ctx, JSON_NUMBER_INT, (json_uint64_t)value);
+}
+
+static int json__tape_uinteger(void* ctx, json_uint64_t value)
+{
+	return json__tape_number(ctx, JSON_NUMBER_UINT, value);
+}
+
+static int json__tape_boolean(void* ctx, int value)
+{
+	return json__tape_value(ctx, value ? JSON_TRUE : JSON_FALSE, 0);
+}
+
+static int json__tape_null(void* ctx)
+{
+	return json__tape_value(ctx, JSON_NULL, 0);
+}
+
+static const json_handler_t json__tape_handler = {
+	json__tape_object_begin,
+	json__tape_end,
+	json__tape_array_begin,
+	json__tape_end,
+	json__tape_key,
+	json__tape_string,
+	json__tape_real,
+	json__tape_integer,
+	json__tape_uinteger,
+	json__tape_boolean,
+	json__tape_null,
+};
+
+json_tape_t* json_parse_tape(const char* text, size_t len)
+{
+	json__tape_builder_t builder;
+	json_tape_t* tape = malloc(sizeof(json_tape_t));
+
+	if (tape == NULL)
+		return NULL;
+
+	/* sized for typical documents, a value needs at least two bytes of text */
+
+	tape->len = 0;
+	tape->cap = len / 4 + 16;
+	tape->words = malloc(tape->cap * sizeof(json_uint64_t));
+	tape->strings_len = 0;
+	tape->strings_cap = len / 2 + 16;
+	tape->strings = malloc(tape->strings_cap);
+
+	builder.tape = tape;
+	builder.depth = -1;
+
+	if (tape->words == NULL || tape->strings == NULL
+		|| !json_parse_sax(text, len, &json__tape_handler, &builder))
+	{
+		json_tape_free(tape);
+		return NULL;
+	}
+
+	return tape;
+}
+
+void json_tape_free(json_tape_t* tape)
+{
+	if (tape == NULL)
+		return;
+
+	free(tape->words);
+	free(tape->strings);
+	free(tape);
+}
+
+static json_tape_value_t json__tape_at(const json_tape_t* tape, size_t index)
+{
+	json_tape_value_t value;
+	value.tape = tape;
+	value.index = index;
+	return value;
+}
+
+static json_uint64_t json__tape_word(json_tape_value_t value)
+{
+	return value.tape->words[value.index];
+}
+
+/*	Index behind the value and its subtree  */
+static size_t json__tape_skip(json_tape_value_t value)
+{
+	json_uint64_t word = json__tape_word(value);
+
+	switch (JSON__TAPE_TAG(word))
+	{
+	case JSON_OBJECT:
+	case JSON_ARRAY:
+		return (size_t)(word & 0xFFFFFFFFu);
+	case JSON_NUMBER:
+		return value.index + 2;
+	}
+
+	return value.index + 1;
+}
+
+json_tape_value_t json_tape_root(const json_tape_t* tape)
+{
+	return json__tape_at(tape, 0);
+}
+
+int json_tape_type(json_tape_value_t value)
+{
+	int tag;
+
+	if (value.tape == NULL || value.index >= value.tape->len)
+		return JSON_NONE;
+
+	tag = JSON__TAPE_TAG(json__tape_word(value));
+	return tag < JSON_NONE ? tag : JSON_NONE;
+}
+
+int json_tape_number_type(json_tape_value_t number)
+{
+	assert(json_tape_type(number) == JSON_NUMBER);
+	return (int)JSON__TAPE_PAYLOAD(json__tape_word(number));
+}
+
+double json_tape_number(json_tape_value_t number)
+{
+	json_uint64_t bits = number.tape->words[number.index + 1];
+	double value;
+
+	switch (json_tape_number_type(number))
+	{
+	case JSON_NUMBER_INT:
+		return (double)(json_int64_t)bits;
+	case JSON_NUMBER_UINT:
+		return (double)bits;
+	}
+
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+json_int64_t json_tape_integer(json_tape_value_t number)
+{
+	if (json_tape_number_type(number) == JSON_NUMBER_REAL)
+		return (json_int64_t)json_tape_number(number);
+
+	return (json_int64_t)number.tape->words[number.index + 1];
+}
+
+json_uint64_t json_tape_uinteger(json_tape_value_t number)
+{
+	if (json_tape_number_type(number) == JSON_NUMBER_REAL)
+		return (json_uint64_t)json_tape_number(number);
+
+	return number.tape->words[number.index + 1];
+}
+
+const char* json_tape_string(json_tape_value_t string)
+{
+	assert(json_tape_type(string) == JSON_STRING);
+	return string.tape->strings + JSON__TAPE_PAYLOAD(json__tape_word(string)) + sizeof(unsigned int);
+}
+
+int json_tape_string_len(json_tape_value_t string)
+{
+	unsigned int len;
+
+	assert(json_tape_type(string) == JSON_STRING);
+	memcpy(&len, string.tape->strings + JSON__TAPE_PAYLOAD(json__tape_word(string)), sizeof(len));
+	return (int)len;
+}
+
+int json_tape_len(json_tape_value_t container)
+{
+	json_tape_value_t i;
+	int len;
+
+	assert(json_tape_type(container) == JSON_OBJECT || json_tape_type(container) == JSON_ARRAY);
+
+	if ((len = (int)((json__tape_word(container) >> 32) & JSON__TAPE_COUNT)) < JSON__TAPE_COUNT)
+		return len;
+
+	/* too many to store, count them */
+
+	for (len = 0, i = json_tape_begin(container); json_tape_type(i) != JSON_NONE;
+		i = json_tape_next(i))
+		len++;
+
+	return len;
+}
+
+json_tape_value_t json_tape_begin(json_tape_value_t container)
+{
+	json_tape_value_t value = json__tape_at(container.tape, container.index + 1);
+
+	assert(json_tape_type(container) == JSON_OBJECT || json_tape_type(container) == JSON_ARRAY);
+
+	if (JSON__TAPE_TAG(json__tape_word(value)) == JSON__TAPE_KEY)
+		value.index++;
+
+	return value;
+}
+
+json_tape_value_t json_tape_next(json_tape_value_t value)
+{
+	if (json_tape_type(value) == JSON_NONE)
+		return value;
+
+	value.index = json__tape_skip(value);
+
+	if (value.index < value.tape->len
+		&& JSON__TAPE_TAG(json__tape_word(value)) == JSON__TAPE_KEY)
+		value.index++;
+
+	return value;
+}
+
+/*	The key word is in front of the value of an object member  */
+const char* json_tape_key(json_tape_value_t value)
+{
+	json_uint64_t word = value.tape->words[value.index - 1];
+
+	assert(JSON__TAPE_TAG(word) == JSON__TAPE_KEY);
+	return value.tape->strings + JSON__TAPE_PAYLOAD(word) + sizeof(unsigned int);
+}
+
+json_tape_value_t json_tape_object_get(json_tape_value_t object, const char* key)
+{
+	size_t len = strlen(key);
+	json_tape_value_t i;
+
+	assert(json_tape_type(object) == JSON_OBJECT);
+
+	for (i = json_tape_begin(object); json_tape_type(i) != JSON_NONE; i = json_tape_next(i))
+	{
+		const char* other = json_tape_key(i);
+		unsigned int other_len;
+
+		memcpy(&other_len, other - sizeof(other_len), sizeof(other_len));
+
+		if (other_len == len && memcmp(other, key, len) == 0)
+			return i;
+	}
+
+	return json__tape_at(NULL, 0);
+}
+
+json_tape_value_t json_tape_array_get(json_tape_value_t array, int index)
+{
+	json_tape_value_t i;
+
+	assert(json_tape_type(array) == JSON_ARRAY);
+
+	for (i = json_tape_begin(array); index > 0 && json_tape_type(i) != JSON_NONE;
+		i = json_tape_next(i))
+		index--;
+
+	return index == 0 && json_tape_type(i) != JSON_NONE ? i : json__tape_at(NULL, 0);
+}
+
+/**************************************************************************************************
+	JSON Lazy  */
+
+/*	Lazy values point into the text, nothing is parsed before it is read. Siblings on the way to
+	a value are skipped by only matching brackets and strings, 'json_lazy_value()' parses and
+	validates the value that is read.  */
+
+static const char* json__lazy_space(const char* c, const char* end)
+{
+	while (c < end && (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r'))
+		c++;
+
+	return c;
+}
+
+static json_lazy_t json__lazy_at(const char* text, const char* end)
+{
+	json_lazy_t value;
+	value.text = text;
+	value.end = end;
+	return value;
+}
+
+static int json__lazy_separator(char c)
+{
+	return c == ',' || c == ']' || c == '}' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/*	End of the literal at c, NULL if it is misspelled or runs into other characters  */
+static const char* json__lazy_literal(const char* c, const char* end)
+{
+	const char* word = *c == 't' ? "true" : *c == 'f' ? "false" : "null";
+	size_t len = strlen(word);
+
+	if ((size_t)(end - c) < len || memcmp(c, word, len) != 0)
+		return NULL;
+
+	c += len;
+	return c == end || json__lazy_separator(*c) ? c : NULL;
+}
+
+/*	End of the value at c, NULL if its brackets or strings are not closed or a literal is
+	invalid  */
+static const char* json__lazy_skip(const char* c, const char* end)
+{
+	char scope[JSON_MAX_DEPTH];
+	int depth = 0;
+
+	if (c >= end)
+		return NULL;
+
+	if (*c == 't' || *c == 'f' || *c == 'n')
+		return json__lazy_literal(c, end);
+
+	if (*c != '{' && *c != '[' && *c != '"')
+	{
+		/* numbers end at the next separator */
+
+		while (c < end && !json__lazy_separator(*c))
+			c++;
+
+		return c;
+	}
+
+	do
+	{
+		switch (*c)
+		{
+		case '"':
+			if ((c = json__string_end(c, end)) == NULL)
+				return NULL;
+			break;
+		case '{':
+		case '[':
+			if (depth == JSON_MAX_DEPTH)
+				return NULL;
+
+			scope[depth++] = *c == '{' ? '}' : ']';
+			break;
+		case '}':
+		case ']':
+			if (depth == 0 || scope[--depth] != *c)
+				return NULL;
+			break;
+		}
+
+		c++;
+	} while (depth && c < end);
+
+	return depth ? NULL : c;
+}
+
+/*	Read a member key at c and move c behind its colon. Returns the key with escapes in place.  */
+static const char* json__lazy_key(const char** c, const char* end, size_t* len)
+{
+	const char* key = *c + 1;
+	const char* close;
+
+	if (*c >= end || **c != '"' || (close = json__string_end(*c, end)) == NULL)
+		return NULL;
+
+	*len = (size_t)(close - key);
+	*c = json__lazy_space(close + 1, end);
+
+	if (*c >= end || **c != ':')
+		return NULL;
+
+	*c = json__lazy_space(*c + 1, end);
+	return key;
+}
+
+static int json__lazy_key_equal(const char* raw, size_t raw_len, const char* key, size_t len)
+{
+	char buffer[256], * decoded = buffer;
+	int equal;
+
+	if (memchr(raw, '\\', raw_len) == NULL)
+		return raw_len == len && memcmp(raw, key, len) == 0;
+
+	/* escapes only make the key shorter */
+
+	if (len > raw_len)
+		return 0;
+
+	if (raw_len >= sizeof(buffer) && (decoded = malloc(raw_len + 1)) == NULL)
+		return 0;
+
+	equal = json__unescape(decoded, raw, raw_len) == (long)len && memcmp(decoded, key, len) == 0;
+
+	if (decoded != buffer)
+		free(decoded);
+
+	return equal;
+}
+
+json_lazy_t json_lazy(const char* text, size_t len)
+{
+	const char* end = text + len;
+
+	json__tables();
+
+	text = json__lazy_space(text, end);
+	return json__lazy_at(text < end ? text : NULL, end);
+}
+
+int json_lazy_type(json_lazy_t value)
+{
+	int type;
+
+	if (value.text == NULL)
+		return JSON_NONE;
+
+	type = json__token_type[(unsigned char)*value.text];
+
+	if ((type == JSON_TRUE || type == JSON_FALSE || type == JSON_NULL)
+		&& json__lazy_literal(value.text, value.end) == NULL)
+		return JSON_NONE;
+
+	return type < JSON_NONE ? type : JSON_NONE;
+}
+
+json_lazy_t json_lazy_get(json_lazy_t object, const char* key)
+{
+	const char* c = object.text;
+	const char* end = object.end;
+	size_t key_len = strlen(key);
+
+	if (json_lazy_type(object) != JSON_OBJECT)
+		return json__lazy_at(NULL, NULL);
+
+	c = json__lazy_space(c + 1, end);
+
+	while (c < end && *c != '}')
+	{
+		size_t len;
+		const char* other = json__lazy_key(&c, end, &len);
+
+		if (other == NULL)
+			break;
+
+		if (json__lazy_key_equal(other, len, key, key_len))
+			return json__lazy_at(c < end ? c : NULL, end);
+
+		if ((c = json__lazy_skip(c, end)) == NULL)
+			break;
+
+		c = json__lazy_space(c, end);
+
+		if (c < end && *c == ',')
+			c = json__lazy_space(c + 1, end);
+		else
+			break;
+	}
+
+	return json__lazy_at(NULL, NULL);
+}
+
+json_lazy_t json_lazy_at(json_lazy_t array, int index)
+{
+	const char* c = array.text;
+	const char* end = array.end;
+
+	if (json_lazy_type(array) != JSON_ARRAY || index < 0)
+		return json__lazy_at(NULL, NULL);
+
+	c = json__lazy_space(c + 1, end);
+
+	while (c < end && *c != ']')
+	{
+		if (index-- == 0)
+			return json__lazy_at(c, end);
+
+		if ((c = json__lazy_skip(c, end)) == NULL)
+			break;
+
+		c = json__lazy_space(c, end);
+
+		if (c < end && *c == ',')
+			c = json__lazy_space(c + 1, end);
+		else
+			break;
+	}
+
+	return json__lazy_at(NULL, NULL);
+}
+
+json_lazy_t json_lazy_find(json_lazy_t value, ...)
+{
+	const char* step;
+	va_list args;
+
+	va_start(args, value);
+
+	while ((step = va_arg(args, const char*)) != NULL && value.text)
+	{
+		if (json_lazy_type(value) == JSON_ARRAY)
+		{
+			/* steps into arrays are decimal indices */
+
+			const char* digit = step;
+			int index = 0;
+
+			while (*digit >= '0' && *digit <= '9' && index < 0x0CCCCCCC)
+				index = index * 10 + (*digit++ - '0');
+
+			value = *step && *digit == 0 ? json_lazy_at(value, index) : json__lazy_at(NULL, NULL);
+		}
+		else
+			value = json_lazy_get(value, step);
+	}
+
+	va_end(args);
+	return value;
+}
+
+json_t json_lazy_value(json_lazy_t value)
+{
+	const char* end = value.text ? json__lazy_skip(value.text, value.end) : NULL;
+
+	if (end == NULL)
+		return json__const_node(JSON_NONE);
+
+	return json__parse(value.text, (size_t)(end - value.text), NULL);
+}
+
+size_t json_lazy_len(json_lazy_t value)
+{
+	const char* end = value.text ? json__lazy_skip(value.text, value.end) : NULL;
+	return end ? (size_t)(end - value.text) : 0;
+}
+
+/**************************************************************************************************
+	JSON Parallel  */
+
+/*	A top-level array is cut into ranges of elements at its commas by a pre-scan that only matches
+	brackets and strings. Every range is parsed as an array of its own on a thread, into an arena
+	of its own if the document goes to an arena. The elements are then copied into one array that
+	is reserved for all of them and the arenas are merged into the arena of the document.  */
+
+#define JSON__PARALLEL_MIN 0x100000
+#define JSON__PARALLEL_RANGE 0x40000
+
+typedef struct json__range_t
+{
+	const char* text;
+	size_t len;
+	int count;
+	json_arena_t* arena;
+	json_t array;
+
+} json__range_t;
+
+typedef struct json__parallel_t
+{
+	json__range_t* ranges;
+	int len;
+	int next;
+	json_arena_t* arena;
+	json__mutex_t mutex;
+
+} json__parallel_t;
+
+/*	Ranges of roughly range_size bytes, NULL if the text is not an array or the pre-scan fails  */
+static json__range_t* json__parallel_split(const char* text, size_t len, size_t range_size,
+	int* out_len)
+{
+	const char* end = text + len;
+	const char* c = json__lazy_space(text, end);
+	const char* start;
+	json__range_t* ranges = NULL;
+	int cap = 0, count = 0;
+
+	*out_len = 0;
+
+	if (c == end || *c != '[')
+		return NULL;
+
+	start = c = json__lazy_space(c + 1, end);
+
+	while (c < end && *c != ']')
+	{
+		if ((c = json__lazy_skip(c, end)) == NULL)
+			break;
+
+		count++;
+		c = json__lazy_space(c, end);
+
+		if (c < end && (*c == ']' || (*c == ',' && (size_t)(c - start) >= range_size)))
+		{
+			if (*out_len == cap)
+			{
+				json__range_t* grown;
+
+				cap = cap ? cap * 2 : 64;
+
+				if ((grown = realloc(ranges, sizeof(json__range_t) * (size_t)cap)) == NULL)
+					break;
+
+				ranges = grown;
+			}
+
+			ranges[*out_len].text = start;
+			ranges[*out_len].len = (size_t)(c - start);
+			ranges[*out_len].count = count;
+			ranges[*out_len].arena = NULL;
+			ranges[*out_len].array = json__const_node(JSON_NONE);
+			(*out_len)++;
+
+			if (*c == ']')
+				return json__lazy_space(c + 1, end) == end ? ranges : (free(ranges), NULL);
+
+			start = json__lazy_space(c + 1, end);
+			count = 0;
+		}
+
+		if (c >= end || *c != ',')
+			break;
+
+		c = json__lazy_space(c + 1, end);
+	}
+
+	free(ranges);
+	return NULL;
+}
+
+/*	Containers, strings and integer cells of a tree parsed into one arena become part of another  */
+static void json__arena_adopt(json_t value, json_arena_t* arena)
+{
+	int i;
+
+	switch (JSON__TYPE(value))
+	{
+	case JSON_OBJECT:
+		JSON__OBJ(value)->arena = arena;
+
+		for (i = 0; i < JSON__OBJ(value)->len; i++)
+			json__arena_adopt(JSON__OBJ(value)->buckets[i].val, arena);
+
+		break;
+	case JSON_ARRAY:
+		JSON__ARR(value)->arena = arena;
+
+		for (i = 0; i < JSON__ARR(value)->len; i++)
+			json__arena_adopt(JSON__ARR(value)->data[i], arena);
+
+		break;
+	case JSON_STRING:
+		JSON__STR(value)->arena = arena;
+		break;
+#if defined(JSON_NAN_BOXING)
+	case JSON_NUMBER:
+		if (JSON__NUM_TYPE(value) != JSON_NUMBER_REAL)
+			JSON__CELL(value)->arena = arena;
+
+		break;
+#endif
+	}
+}
+
+/*	The range is parsed in place as the elements of an array, the parser starts inside the array
+	and nothing is copied.  */
+static void json__parallel_range(json__parallel_t* parallel, json__range_t* range)
+{
+	json_parser_t parser;
+	int i;
+
+	if (parallel->arena && (range->arena = json_arena_new(0)) == NULL)
+		return;
+
+	json__dom_init(&parser, range->arena);
+
+	if (json__dom_array_begin(&parser.dom))
+	{
+		parser.scope[++parser.depth] = JSON_ARRAY;
+		parser.state = JSON_ARRAY_START;
+		json__parser_run(&parser, range->text, range->len, 1);
+
+		if (!parser.error)
+			json__parser_run(&parser, "]", 1, 1);
+	}
+
+	range->array = json_parser_finish(&parser);
+
+	if (parallel->arena && JSON__TYPE(range->array) == JSON_ARRAY)
+	{
+		for (i = 0; i < JSON__ARR(range->array)->len; i++)
+			json__arena_adopt(JSON__ARR(range->array)->data[i], parallel->arena);
+	}
+}
+
+JSON__THREAD_FN(json__parallel_worker, arg)
+{
+	json__parallel_t* parallel = arg;
+
+	for (;;)
+	{
+		int i;
+
+		json__mutex_lock(&parallel->mutex);
+		i = parallel->next < parallel->len ? parallel->next++ : -1;
+		json__mutex_unlock(&parallel->mutex);
+
+		if (i < 0)
+			break;
+
+		json__parallel_range(parallel, parallel->ranges + i);
+	}
+
+	JSON__THREAD_RETURN;
+}
+
+/*	Copy the elements of the ranges into one array and release the ranges  */
+static json_t json__parallel_join(json__parallel_t* parallel)
+{
+	json_t result = json__const_node(JSON_NONE);
+	json__array_t* array;
+	int i, total = 0;
+
+	for (i = 0; i < parallel->len; i++)
+	{
+		json__range_t* range = parallel->ranges + i;
+
+		if (JSON__TYPE(range->array) != JSON_ARRAY || JSON__ARR(range->array)->len != range->count)
+			break;
+
+		total += range->count;
+	}
+
+	if (i == parallel->len)
+		result = json__array_node(parallel->arena);
+
+	if (JSON__TYPE(result) == JSON_ARRAY)
+	{
+		array = JSON__ARR(result);
+		json__array_reserve(array, total);
+
+		if (array->data == NULL)
+		{
+			json_free(result);
+			result = json__const_node(JSON_NONE);
+		}
+	}
+
+	for (i = 0; i < parallel->len; i++)
+	{
+		json__range_t* range = parallel->ranges + i;
+
+		if (JSON__TYPE(result) == JSON_ARRAY)
+		{
+			json__array_t* part = JSON__ARR(range->array);
+
+			array = JSON__ARR(result);
+			memcpy(array->data + array->len, part->data, sizeof(json_t) * (size_t)part->len);
+			array->len += part->len;
+
+			/* the elements moved, only the range array itself is released */
+
+			if (part->arena == NULL)
+			{
+				json__array_free(part);
+				free(part);
+			}
+		}
+		else
+			json_free(range->array);
+
+		if (range->arena)
+		{
+			if (JSON__TYPE(result) == JSON_ARRAY)
+				json_arena_merge(parallel->arena, range->arena);
+
+			json_arena_free(range->arena);
+		}
+	}
+
+	return result;
+}
+
+json_t json_parse_parallel(const char* text, size_t len, int threads, json_arena_t* arena)
+{
+	json__parallel_t parallel;
+	json__thread_t workers[64];
+	size_t range_size;
+	int i, started;
+
+	json__tables();
+
+	if (threads <= 0)
+		threads = json__cpu_count();
+
+	if (threads > (int)(sizeof(workers) / sizeof(workers[0])) + 1)
+		threads = (int)(sizeof(workers) / sizeof(workers[0])) + 1;
+
+	/* a few ranges per thread so that threads finishing early find more work */
+
+	range_size = len / ((size_t)threads * 4);
+
+	if (range_size < JSON__PARALLEL_RANGE)
+		range_size = JSON__PARALLEL_RANGE;
+
+	if (threads == 1 || len < JSON__PARALLEL_MIN
+		|| (parallel.ranges = json__parallel_split(text, len, range_size, &parallel.len)) == NULL)
+		return json__parse(text, len, arena);
+
+	parallel.next = 0;
+	parallel.arena = arena;
+	json__mutex_init(&parallel.mutex);
+
+	for (started = 0; started < threads - 1 && started < parallel.len - 1; started++)
+	{
+		if (!json__thread_start(workers + started, json__parallel_worker, &parallel))
+			break;
+	}
+
+	json__parallel_worker(&parallel);
+
+	for (i = 0; i < started; i++)
+		json__thread_join(workers + i);
+
+	json__mutex_free(&parallel.mutex);
+
+	{
+		json_t result = json__parallel_join(&parallel);
+		free(parallel.ranges);
+		return result;
+	}
+}
+
+/**************************************************************************************************
+	Json Dump  */
+
+/*	Output goes through a window [begin, end). When it is full 'flush' makes room, by growing the
+	string, counting and discarding the bytes or failing for a fixed buffer. Everything before
+	'ptr' that was flushed is counted in 'flushed'.  */
+
+/*	Write a 64 bit integer, bits is the two's complement if neg is set.  */
+static int json__itoa(json_uint64_t bits, int neg, char* buffer)
+{
+	char digits[20];
+	int len = 0, i = 0;
+
+	if (neg)
+	{
+		buffer[i++] = '-';
+		bits = 0 - bits;
+	}
+
+	do
+	{
+		digits[len++] = (char)('0' + bits % 10);
+		bits /= 10;
+	} while (bits);
+
+	while (len)
+		buffer[i++] = digits[--len];
+
+	buffer[i] = 0;
+	return i;
+}
+
+typedef struct json__writer_t
+{
+	char* begin;
+	char* ptr;
+	char* end;
+	size_t flushed;
+	int (*flush)(struct json__writer_t* writer);
+	void* ctx;
+	int indent;
+	int error;
+
+} json__writer_t;
+
+typedef struct json__stream_t
+{
+	json_write_fn write;
+	void* ctx;
+
+} json__stream_t;
+
+/*	Size of the reused buffer when dumping to a stream.  */
+#define JSON__DUMP_BUFFER 0x4000
+
+static const char json__indent_tabs[] = "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
+static const char json__indent_spaces[] = "                                                                ";
+
+static void json__write(json__writer_t* writer, const char* data, size_t len)
+{
+	while ((size_t)(writer->end - writer->ptr) < len)
+	{
+		size_t room = (size_t)(writer->end - writer->ptr);
+
+		memcpy(writer->ptr, data, room);
+		writer->ptr += room;
+		data += room;
+		len -= room;
+
+		if (writer->error || !writer->flush(writer))
+		{
+			writer->error = 1;
+			return;
+		}
+	}
+
+	memcpy(writer->ptr, data, len);
+	writer->ptr += len;
+}
+
+static void json__write_indent(json__writer_t* writer, int depth)
+{
+	const char* run = writer->indent < 0 ? json__indent_tabs : json__indent_spaces;
+	size_t run_len = writer->indent < 0 ? sizeof(json__indent_tabs) - 1 :
+		sizeof(json__indent_spaces) - 1;
+	size_t len = (size_t)depth * (size_t)(writer->indent < 0 ? 1 : writer->indent);
+
+	json__write(writer, "\n", 1);
+
+	for (; len > run_len; len -= run_len)
+		json__write(writer, run, run_len);
+
+	json__write(writer, run, len);
+}
+
+/*	Quote and escape a string. Runs without special characters are copied at once.  */
+static void json__write_string(json__writer_t* writer, const char* str, size_t len)
+{
+	static const char hex[] = "0123456789abcdef";
+	const unsigned char* c = (const unsigned char*)str;
+	const unsigned char* end = c + len;
+
+	json__write(writer, "\"", 1);
+
+	while (c != end)
+	{
+		const unsigned char* run = c;
+		char escape[6];
+
+		c = (const unsigned char*)json__escape_scan((const char*)c, (const char*)end);
+
+		json__write(writer, (const char*)run, (size_t)(c - run));
+
+		if (c == end)
+			break;
+
+		escape[0] = '\\';
+
+		switch (*c)
+		{
+		case '"': escape[1] = '"'; break;
+		case '\\': escape[1] = '\\'; break;
+		case '\b': escape[1] = 'b'; break;
+		case '\f': escape[1] = 'f'; break;
+		case '\n': escape[1] = 'n'; break;
+		case '\r': escape[1] = 'r'; break;
+		case '\t': escape[1] = 't'; break;
+		default:
+			memcpy(escape + 1, "u00", 3);
+			escape[4] = hex[*c >> 4];
+			escape[5] = hex[*c & 15];
+			json__write(writer, escape, 6);
+			c++;
+			continue;
+		}
+
+		json__write(writer, escape, 2);
+		c++;
+	}
+
+	json__write(writer, "\"", 1);
+}
+
+/*	Everything in front of member i of a container at depth: the comma, the indentation and the
+	key of object members.  */
+static void json__write_member(json__writer_t* writer, json_t container, int i, int depth)
+{
+	if (i)
+		json__write(writer, ",", 1);
+
+	if (writer->indent)
+		json__write_indent(writer, depth + 1);
+
+	if (JSON__TYPE(container) == JSON_OBJECT)
+	{
+		const char* key = JSON__OBJ(container)->buckets[i].key;
+
+		json__write_string(writer, key, json__key_len(JSON__OBJ(container), key));
+		json__write(writer, ": ", writer->indent ? 2 : 1);
+	}
+}
+
+static void json__write_value(json__writer_t* writer, json_t value, int depth)
+{
+	char number[JSON_DTOA_SIZE];
+	int i;
+
+	switch (JSON__TYPE(value))
+	{
+	case JSON_OBJECT:
+		json__write(writer, "{", 1);
+
+		for (i = 0; i < JSON__OBJ(value)->len; i++)
+		{
+			json__write_member(writer, value, i, depth);
+			json__write_value(writer, JSON__OBJ(value)->buckets[i].val, depth + 1);
+		}
+
+		if (writer->indent && JSON__OBJ(value)->len)
+			json__write_indent(writer, depth);
+
+		json__write(writer, "}", 1);
+		break;
+
+	case JSON_ARRAY:
+		json__write(writer, "[", 1);
+
+		for (i = 0; i < JSON__ARR(value)->len; i++)
+		{
+			json__write_member(writer, value, i, depth);
+			json__write_value(writer, JSON__ARR(value)->data[i], depth + 1);
+		}
+
+		if (writer->indent && JSON__ARR(value)->len)
+			json__write_indent(writer, depth);
+
+		json__write(writer, "]", 1);
+		break;
+
+	case JSON_STRING:
+		json__write_string(writer, JSON__STR(value)->data, (size_t)JSON__STR(value)->len);
+		break;
+
+	case JSON_NUMBER:
+		if (JSON__NUM_TYPE(value) == JSON_NUMBER_REAL)
+			i = json_dtoa(JSON__NUM(value), number, sizeof(number));
+		else
+			i = json__itoa(JSON__UINT(value),
+				JSON__NUM_TYPE(value) == JSON_NUMBER_INT && JSON__INT(value) < 0, number);
+
+		json__write(writer, number, (size_t)i);
+		break;
+
+	case JSON_TRUE:
+		json__write(writer, "true", 4);
+		break;
+
+	case JSON_FALSE:
+		json__write(writer, "false", 5);
+		break;
+
+	case JSON_NULL:
+		json__write(writer, "null", 4);
+		break;
+	}
+}
+
+static void json__writer_init(json__writer_t* writer, int indent, char* buffer, size_t size,
+	int (*flush)(json__writer_t*), void* ctx)
+{
+	writer->begin = buffer;
+	writer->ptr = buffer;
+	writer->end = buffer + size;
+	writer->flushed = 0;
+	writer->flush = flush;
+	writer->ctx = ctx;
+	writer->indent = indent;
+	writer->error = 0;
+
+	json__tables();
+}
+
+static size_t json__writer_len(json__writer_t* writer)
+{
+	return writer->flushed + (size_t)(writer->ptr - writer->begin);
+}
+
+/*	Grow the string to twice the size. One byte stays reserved for the terminating 0.  */
+static int json__flush_string(json__writer_t* writer)
+{
+	json__string_t* str = (json__string_t*)writer->ctx;
+
+	str->len = (int)(writer->ptr - str->data);
+
+	if (!json__string_reserve(str, str->cap))
+		return 0;
+
+	writer->begin = str->data;
+	writer->ptr = str->data + str->len;
+	writer->end = str->data + str->cap - 1;
+	return 1;
+}
+
+static int json__flush_count(json__writer_t* writer)
+{
+	writer->flushed += (size_t)(writer->ptr - writer->begin);
+	writer->ptr = writer->begin;
+	return 1;
+}
+
+static int json__flush_fail(json__writer_t* writer)
+{
+	(void)writer;
+	return 0;
+}
+
+/*	Hand the window to the write callback and reuse it.  */
+static int json__flush_stream(json__writer_t* writer)
+{
+	json__stream_t* stream = (json__stream_t*)writer->ctx;
+	size_t len = (size_t)(writer->ptr - writer->begin);
+
+	if (len && !stream->write(stream->ctx, writer->begin, len))
+		return 0;
+
+	writer->flushed += len;
+	writer->ptr = writer->begin;
+	return 1;
+}
+
+static int json__write_file(void* ctx, const char* data, size_t len)
+{
+	return fwrite(data, 1, len, (FILE*)ctx) == len;
+}
+
+static int json__write_fd(void* ctx, const char* data, size_t len)
+{
+	int fd = *(int*)ctx;
+
+	while (len)
+	{
+#if defined(_WIN32)
+		int n = _write(fd, data, (unsigned int)(len < 0x40000000 ? len : 0x40000000));
+#else
+		long n = (long)write(fd, data, len);
+#endif
+
+		if (n < 0 && errno == EINTR)
+			continue;
+
+		if (n <= 0)
+			return 0;
+
+		data += n;
+		len -= (size_t)n;
+	}
+
+	return 1;
+}
+
+/*	Dump JSON value to string.  */
+json_t json_dump(json_t value)
+{
+	return json_dump_indent(value, JSON_DUMP_TABS);
+}
+
+json_t json_dump_indent(json_t value, int indent)
+{
+	json__writer_t writer;
+	json__string_t* str;
+	json_t string = json_string("");
+
+	if (JSON__TYPE(string) == JSON_NONE)
+		return string;
+
+	str = JSON__STR(string);
+
+	if (json__string_reserve(str, 0x100))
+	{
+		json__writer_init(&writer, indent, str->data, (size_t)str->cap - 1, json__flush_string,
+			str);
+		json__write_value(&writer, value, 0);
+	}
+	else
+		writer.error = 1;
+
+	if (writer.error)
+	{
+		json_free(string);
+		return json__const_node(JSON_NONE);
+	}
+
+	str->len = (int)(writer.ptr - str->data);
+	str->data[str->len] = 0;
+	return string;
+}
+
+size_t json_dump_size(json_t value, int indent)
+{
+	json__writer_t writer;
+	char scratch[0x200];
+
+	json__writer_init(&writer, indent, scratch, sizeof(scratch), json__flush_count, NULL);
+	json__write_value(&writer, value, 0);
+
+	return json__writer_len(&writer);
+}
+
+size_t json_dump_buffer(json_t value, int indent, char* buffer, size_t size)
+{
+	json__writer_t writer;
+
+	if (size == 0)
+		return 0;
+
+	json__writer_init(&writer, indent, buffer, size - 1, json__flush_fail, NULL);
+	json__write_value(&writer, value, 0);
+
+	if (writer.error)
+		return 0;
+
+	*writer.ptr = 0;
+	return json__writer_len(&writer);
+}
+
+int json_dump_to_writer(json_t value, int indent, json_write_fn write, void* ctx)
+{
+	json__writer_t writer;
+	json__stream_t stream;
+	char buffer[JSON__DUMP_BUFFER];
+
+	stream.write = write;
+	stream.ctx = ctx;
+
+	json__writer_init(&writer, indent, buffer, sizeof(buffer), json__flush_stream, &stream);
+	json__write_value(&writer, value, 0);
+
+	return !writer.error && json__flush_stream(&writer);
+}
+
+int json_dump_file(json_t value, int indent, FILE* file)
+{
+	return json_dump_to_writer(value, indent, json__write_file, file);
+}
+
+int json_dump_fd(json_t value, int indent, int fd)
+{
+	return json_dump_to_writer(value, indent, json__write_fd, &fd);
+}
+
+/*	Parallel dump. Containers with a large estimated output are split into tasks of consecutive
+	members. The text between the tasks, brackets and the separators and keys in front of split
+	members, is written on the calling thread while planning. Threads render the tasks, then copy
+	them with the glue in front of them to offsets in the result.  */
+
+#define JSON__DUMP_GRAIN 0x10000
+
+typedef struct json__dump_task_t
+{
+	json_t container;
+	int first;
+	int last;
+	int depth;
+	size_t weight;
+	size_t glue;
+	size_t offset;
+	json_t text;
+
+} json__dump_task_t;
+
+typedef struct json__dump_plan_t
+{
+	json__writer_t glue;
+	json__string_t text;
+	json__dump_task_t* tasks;
+	int len;
+	int cap;
+	int next;
+	int threads;
+	int error;
+	char* output;
+	json__mutex_t mutex;
+
+} json__dump_plan_t;
+
+/*	Rough output size of value, counting stops once limit is reached  */
+static size_t json__dump_weight(json_t value, size_t limit)
+{
+	size_t weight = 8;
+	int i;
+
+	switch (JSON__TYPE(value))
+	{
+	case JSON_OBJECT:
+		for (i = 0; i < JSON__OBJ(value)->len && weight < limit; i++)
+			weight += 16 + json__dump_weight(JSON__OBJ(value)->buckets[i].val, limit - weight);
+
+		break;
+	case JSON_ARRAY:
+		for (i = 0; i < JSON__ARR(value)->len && weight < limit; i++)
+			weight += 2 + json__dump_weight(JSON__ARR(value)->data[i], limit - weight);
+
+		break;
+	case JSON_STRING:
+		weight += (size_t)JSON__STR(value)->len;
+		break;
+	case JSON_NUMBER:
+		weight += 16;
+		break;
+	}
+
+	return weight;
+}
+
+/*	Members first to last of container, the glue written so far goes in front of them  */
+static void json__dump_push(json__dump_plan_t* plan, json_t container, int first, int last,
+	int depth, size_t weight)
+{
+	json__dump_task_t* task;
+
+	if (plan->len == plan->cap)
+	{
+		json__dump_task_t* grown;
+		int cap = plan->cap ? plan->cap * 2 : 64;
+
+		if ((grown = realloc(plan->tasks, sizeof(json__dump_task_t) * (size_t)cap)) == NULL)
+		{
+			plan->error = 1;
+			return;
+		}
+
+		plan->tasks = grown;
+		plan->cap = cap;
+	}
+
+	task = plan->tasks + plan->len++;
+	task->container = container;
+	task->first = first;
+	task->last = last;
+	task->depth = depth;
+	task->weight = weight;
+	task->glue = (size_t)(plan->glue.ptr - plan->glue.begin);
+	task->text = json__const_node(JSON_NONE);
+}
+
+static void json__dump_plan(json__dump_plan_t* plan, json_t container, int depth)
+{
+	int object = JSON__TYPE(container) == JSON_OBJECT;
+	int len = object ? JSON__OBJ(container)->len : JSON__ARR(container)->len;
+	int i, first = 0;
+	size_t weight = 0;
+
+	json__write(&plan->glue, object ? "{" : "[", 1);
+
+	for (i = 0; i < len; i++)
+	{
+		json_t value = object ? JSON__OBJ(container)->buckets[i].val : JSON__ARR(container)->data[i];
+		size_t member = json__dump_weight(value, JSON__DUMP_GRAIN);
+
+		if (member >= JSON__DUMP_GRAIN
+			&& (JSON__TYPE(value) == JSON_OBJECT || JSON__TYPE(value) == JSON_ARRAY))
+		{
+			/* large containers are split themselves */
+
+			if (first < i)
+				json__dump_push(plan, container, first, i, depth, weight);
+
+			json__write_member(&plan->glue, container, i, depth);
+			json__dump_plan(plan, value, depth + 1);
+			first = i + 1;
+			weight = 0;
+		}
+		else if ((weight += member) >= JSON__DUMP_GRAIN)
+		{
+			json__dump_push(plan, container, first, i + 1, depth, weight);
+			first = i + 1;
+			weight = 0;
+		}
+	}
+
+	if (first < len)
+		json__dump_push(plan, container, first, len, depth, weight);
+
+	if (plan->glue.indent && len)
+		json__write_indent(&plan->glue, depth);
+
+	json__write(&plan->glue, object ? "}" : "]", 1);
+}
+
+static void json__dump_task(json__dump_plan_t* plan, json__dump_task_t* task)
+{
+	json__writer_t writer;
+	json__string_t* str;
+	int i;
+
+	task->text = json_string("");
+
+	if (JSON__TYPE(task->text) == JSON_NONE)
+		return;
+
+	/* the estimate is close enough to skip most of the growing */
+
+	str = JSON__STR(task->text);
+
+	if (!json__string_reserve(str, task->weight < 0x10000000
+		? (int)(task->weight + task->weight / 4 + 0x100) : 0x100))
+	{
+		json_free(task->text);
+		task->text = json__const_node(JSON_NONE);
+		return;
+	}
+
+	json__writer_init(&writer, plan->glue.indent, str->data, (size_t)str->cap - 1,
+		json__flush_string, str);
+
+	for (i = task->first; i < task->last; i++)
+	{
+		json_t container = task->container;
+
+		json__write_member(&writer, container, i, task->depth);
+		json__write_value(&writer, JSON__TYPE(container) == JSON_OBJECT
+			? JSON__OBJ(container)->buckets[i].val : JSON__ARR(container)->data[i], task->depth + 1);
+	}
+
+	if (writer.error)
+	{
+		json_free(task->text);
+		task->text = json__const_node(JSON_NONE);
+		return;
+	}
+
+	str->len = (int)(writer.ptr - str->data);
+}
+
+/*	Copy the glue in front of a task and its text to their place in the result  */
+static void json__dump_copy(json__dump_plan_t* plan, json__dump_task_t* task)
+{
+	size_t glue = task == plan->tasks ? 0 : task[-1].glue;
+	char* ptr = plan->output + task->offset;
+
+	memcpy(ptr, plan->glue.begin + glue, task->glue - glue);
+	memcpy(ptr + task->glue - glue, JSON__STR(task->text)->data,
+		(size_t)JSON__STR(task->text)->len);
+
+	json_free(task->text);
+	task->text = json__const_node(JSON_NONE);
+}
+
+/*	Tasks are rendered in a first run and copied into the result in a second one  */
+JSON__THREAD_FN(json__dump_worker, arg)
+{
+	json__dump_plan_t* plan = arg;
+
+	for (;;)
+	{
+		int i;
+
+		json__mutex_lock(&plan->mutex);
+		i = plan->next < plan->len ? plan->next++ : -1;
+		json__mutex_unlock(&plan->mutex);
+
+		if (i < 0)
+			break;
+
+		if (plan->output)
+			json__dump_copy(plan, plan->tasks + i);
+		else
+			json__dump_task(plan, plan->tasks + i);
+	}
+
+	JSON__THREAD_RETURN;
+}
+
+static void json__dump_run(json__dump_plan_t* plan, int threads)
+{
+	json__thread_t workers[64];
+	int i, started;
+
+	if (threads > (int)(sizeof(workers) / sizeof(workers[0])) + 1)
+		threads = (int)(sizeof(workers) / sizeof(workers[0])) + 1;
+
+	plan->next = 0;
+
+	for (started = 0; started < threads - 1 && started < plan->len - 1; started++)
+	{
+		if (!json__thread_start(workers + started, json__dump_worker, plan))
+			break;
+	}
+
+	json__dump_worker(plan);
+
+	for (i = 0; i < started; i++)
+		json__thread_join(workers + i);
+}
+
+/*	Offsets of the tasks in the result and its length, sets the error if a task or the glue could
+	not be rendered  */
+static size_t json__dump_layout(json__dump_plan_t* plan)
+{
+	size_t len = 0, glue = 0;
+	int i;
+
+	if (plan->glue.error)
+		plan->error = 1;
+
+	for (i = 0; i < plan->len; i++)
+	{
+		json__dump_task_t* task = plan->tasks + i;
+
+		if (JSON__TYPE(task->text) == JSON_NONE)
+			plan->error = 1;
+		else
+		{
+			task->offset = len;
+			len += task->glue - glue + (size_t)JSON__STR(task->text)->len;
+			glue = task->glue;
+		}
+	}
+
+	return len + json__writer_len(&plan->glue) - glue;
+}
+
+/*	Plan the dump and render its tasks. Returns 0 if the value is better dumped on the calling
+	thread or the glue could not be allocated.  */
+static int json__dump_begin(json__dump_plan_t* plan, json_t value, int indent, int threads)
+{
+	if (threads <= 0)
+		threads = json__cpu_count();
+
+	if (threads == 1 || (JSON__TYPE(value) != JSON_OBJECT && JSON__TYPE(value) != JSON_ARRAY)
+		|| json__dump_weight(value, JSON__DUMP_GRAIN * 4) < JSON__DUMP_GRAIN * 4)
+		return 0;
+
+	plan->text = json__string_new(0x100);
+
+	if (plan->text.data == NULL)
+		return 0;
+
+	json__writer_init(&plan->glue, indent, plan->text.data, (size_t)plan->text.cap - 1,
+		json__flush_string, &plan->text);
+
+	plan->tasks = NULL;
+	plan->len = 0;
+	plan->cap = 0;
+	plan->threads = threads;
+	plan->error = 0;
+	plan->output = NULL;
+	json__dump_plan(plan, value, 0);
+
+	json__mutex_init(&plan->mutex);
+	json__dump_run(plan, threads);
+	return 1;
+}
+
+/*	Copy the tasks and the glue after the last one to output, len bytes in total  */
+static void json__dump_copy_all(json__dump_plan_t* plan, char* output, size_t len)
+{
+	size_t glue = plan->len ? plan->tasks[plan->len - 1].glue : 0;
+	size_t tail = json__writer_len(&plan->glue) - glue;
+
+	plan->output = output;
+	json__dump_run(plan, plan->threads);
+	memcpy(output + len - tail, plan->glue.begin + glue, tail);
+}
+
+static void json__dump_end(json__dump_plan_t* plan)
+{
+	int i;
+
+	json__mutex_free(&plan->mutex);
+
+	for (i = 0; i < plan->len; i++)
+		json_free(plan->tasks[i].text);
+
+	free(plan->tasks);
+	json__string_free(&plan->text);
+}
+
+json_t json_dump_parallel(json_t value, int indent, int threads)
+{
+	json__dump_plan_t plan;
+	json_t string = json__const_node(JSON_NONE);
+	size_t len;
+
+	if (!json__dump_begin(&plan, value, indent, threads))
+		return json_dump_indent(value, indent);
+
+	len = json__dump_layout(&plan);
+
+	/* larger results go through 'json_dump_parallel_buffer()' */
+
+	if (!plan.error && len < 0x40000000)
+		string = json_string("");
+
+	if (JSON__TYPE(string) == JSON_STRING && !json__string_reserve(JSON__STR(string), (int)len))
+	{
+		json_free(string);
+		string = json__const_node(JSON_NONE);
+	}
+
+	if (JSON__TYPE(string) == JSON_STRING)
+	{
+		json__dump_copy_all(&plan, JSON__STR(string)->data, len);
+		JSON__STR(string)->len = (int)len;
+		JSON__STR(string)->data[len] = 0;
+	}
+
+	json__dump_end(&plan);
+	return string;
+}
+
+size_t json_dump_parallel_buffer(json_t value, int indent, int threads, char* buffer,
+	size_t size)
+{
+	json__dump_plan_t plan;
+	size_t len;
+
+	if (!json__dump_begin(&plan, value, indent, threads))
+		return json_dump_buffer(value, indent, buffer, size);
+
+	len = json__dump_layout(&plan);
+
+	if (plan.error || len >= size)
+		len = 0;
+	else
+	{
+		json__dump_copy_all(&plan, buffer, len);
+		buffer[len] = 0;
+	}
+
+	json__dump_end(&plan);
+	return len;
+}
+
+int json_dump_parallel_to_writer(json_t value, int indent, int threads, json_write_fn write,
+	void* ctx)
+{
+	json__dump_plan_t plan;
+	size_t len, glue = 0;
+	int i;
+
+	if (!json__dump_begin(&plan, value, indent, threads))
+		return json_dump_to_writer(value, indent, write, ctx);
+
+	json__dump_layout(&plan);
+
+	/* the tasks are passed to write in order, each with the glue in front of it */
+
+	for (i = 0; i < plan.len && !plan.error; i++)
+	{
+		json__string_t* text = JSON__STR(plan.tasks[i].text);
+
+		if ((len = plan.tasks[i].glue - glue) && !write(ctx, plan.glue.begin + glue, len))
+			plan.error = 1;
+		else if (text->len && !write(ctx, text->data, (size_t)text->len))
+			plan.error = 1;
+
+		glue = plan.tasks[i].glue;
+	}
+
+	if (!plan.error && (len = json__writer_len(&plan.glue) - glue)
+		&& !write(ctx, plan.glue.begin + glue, len))
+		plan.error = 1;
+
+	json__dump_end(&plan);
+	return !plan.error;
+}
+
+/**************************************************************************************************
+	JSON MessagePack  */
+
+/*	Every value is written in its shortest MessagePack form. Numbers that are integers become
+	MessagePack integers and are read back like parsed JSON numbers, -0 is not an integer. Doubles
+	a float represents exactly, -0 included, become float 32, NaN and the rest float 64. Lengths
+	come first, so the decoder allocates arrays, objects and strings with their exact size.  */
+
+#define JSON__FLOAT_MAX 3.4028234663852886e38
+
+/*	Tag followed by size bytes of value, big endian  */
+static void json__pack(json__writer_t* writer, int tag, json_uint64_t value, int size)
+{
+	char bytes[9];
+	int i;
+
+	bytes[0] = (char)tag;
+
+	for (i = size; i > 0; i--)
+	{
+		bytes[i] = (char)(value & 0xFF);
+		value >>= 8;
+	}
+
+	json__write(writer, bytes, (size_t)size + 1);
+}
+
+static void json__pack_header(json__writer_t* writer, int type, size_t len)
+{
+	if (type == JSON_STRING)
+	{
+		if (len < 32)
+			json__pack(writer, 0xA0 | (int)len, 0, 0);
+		else if (len < 0x100)
+			json__pack(writer, 0xD9, len, 1);
+		else if (len < 0x10000)
+			json__pack(writer, 0xDA, len, 2);
+		else
+			json__pack(writer, 0xDB, len, 4);
+	}
+	else if (len < 16)
+		json__pack(writer, (type == JSON_OBJECT ? 0x80 : 0x90) | (int)len, 0, 0);
+	else if (len < 0x10000)
+		json__pack(writer, type == JSON_OBJECT ? 0xDE : 0xDC, len, 2);
+	else
+		json__pack(writer, type == JSON_OBJECT ? 0xDF : 0xDD, len, 4);
+}
+
+/*	Write a 64 bit integer, bits is the two's complement if neg is set.  */
+static void json__pack_integer(json__writer_t* writer, json_uint64_t bits, int neg)
+{
+	json_int64_t value = (json_int64_t)bits;
+
+	if (!neg)
+	{
+		if (bits < 0x80)
+			json__pack(writer, (int)bits, 0, 0);
+		else if (bits < 0x100)
+			json__pack(writer, 0xCC, bits, 1);
+		else if (bits < 0x10000)
+			json__pack(writer, 0xCD, bits, 2);
+		else if (bits < JSON__U64(1, 0))
+			json__pack(writer, 0xCE, bits, 4);
+		else
+			json__pack(writer, 0xCF, bits, 8);
+	}
+	else if (value >= -32)
+		json__pack(writer, (int)(bits & 0xFF), 0, 0);
+	else if (value >= -0x80)
+		json__pack(writer, 0xD0, bits, 1);
+	else if (value >= -0x8000)
+		json__pack(writer, 0xD1, bits, 2);
+	else if (value >= -(json_int64_t)0x7FFFFFFF - 1)
+		json__pack(writer, 0xD2, bits, 4);
+	else
+		json__pack(writer, 0xD3, bits, 8);
+}
+
+static void json__pack_number(json__writer_t* writer, double number)
+{
+	json_uint64_t bits;
+	unsigned int single_bits;
+	float single;
+
+	memcpy(&bits, &number, sizeof(bits));
+
+	if (number >= -(double)JSON__EXACT_INT && number <= (double)JSON__EXACT_INT
+		&& (double)(json_int64_t)number == number && bits != JSON__U64(0x80000000, 0))
+	{
+		json__pack_integer(writer, (json_uint64_t)(json_int64_t)number, number < 0);
+		return;
+	}
+
+	if (number >= -JSON__FLOAT_MAX && number <= JSON__FLOAT_MAX
+		&& (double)(single = (float)number) == number)
+	{
+		memcpy(&single_bits, &single, sizeof(single_bits));
+		json__pack(writer, 0xCA, single_bits, 4);
+		return;
+	}
+
+	json__pack(writer, 0xCB, bits, 8);
+}
+
+static void json__pack_value(json__writer_t* writer, json_t value)
+{
+	int i;
+
+	switch (JSON__TYPE(value))
+	{
+	case JSON_OBJECT:
+		json__pack_header(writer, JSON_OBJECT, (size_t)JSON__OBJ(value)->len);
+
+		for (i = 0; i < JSON__OBJ(value)->len; i++)
+		{
+			json_bucket_t* bucket = JSON__OBJ(value)->buckets + i;
+			size_t len = json__key_len(JSON__OBJ(value), bucket->key);
+
+			json__pack_header(writer, JSON_STRING, len);
+			json__write(writer, bucket->key, len);
+			json__pack_value(writer, bucket->val);
+		}
+
+		break;
+
+	case JSON_ARRAY:
+		json__pack_header(writer, JSON_ARRAY, (size_t)JSON__ARR(value)->len);
+
+		for (i = 0; i < JSON__ARR(value)->len; i++)
+			json__pack_value(writer, JSON__ARR(value)->data[i]);
+
+		break;
+
+	case JSON_STRING:
+		json__pack_header(writer, JSON_STRING, (size_t)JSON__STR(value)->len);
+		json__write(writer, JSON__STR(value)->data, (size_t)JSON__STR(value)->len);
+		break;
+
+	case JSON_NUMBER:
+		if (JSON__NUM_TYPE(value) == JSON_NUMBER_REAL)
+			json__pack_number(writer, JSON__NUM(value));
+		else
+			json__pack_integer(writer, JSON__UINT(value),
+				JSON__NUM_TYPE(value) == JSON_NUMBER_INT && JSON__INT(value) < 0);
+
+		break;
+
+	case JSON_TRUE:
+		json__pack(writer, 0xC3, 0, 0);
+		break;
+
+	case JSON_FALSE:
+		json__pack(writer, 0xC2, 0, 0);
+		break;
+
+	case JSON_NULL:
+		json__pack(writer, 0xC0, 0, 0);
+		break;
+	}
+}
+
+/*	Double the heap buffer of the writer  */
+static int json__flush_heap(json__writer_t* writer)
+{
+	size_t len = (size_t)(writer->ptr - writer->begin);
+	size_t cap = (size_t)(writer->end - writer->begin) * 2;
+	char* data = realloc(writer->begin, cap);
+
+	if (data == NULL)
+		return 0;
+
+	writer->begin = data;
+	writer->ptr = data + len;
+	writer->end = data + cap;
+	return 1;
+}
+
+char* json_msgpack(json_t value, size_t* len)
+{
+	json__writer_t writer;
+	char* data = malloc(0x100);
+
+	if (data == NULL)
+		return NULL;
+
+	json__writer_init(&writer, 0, data, 0x100, json__flush_heap, NULL);
+	json__pack_value(&writer, value);
+
+	if (writer.error)
+	{
+		free(writer.begin);
+		return NULL;
+	}
+
+	*len = (size_t)(writer.ptr - writer.begin);
+	return writer.begin;
+}
+
+size_t json_msgpack_size(json_t value)
+{
+	json__writer_t writer;
+	char scratch[0x200];
+
+	json__writer_init(&writer, 0, scratch, sizeof(scratch), json__flush_count, NULL);
+	json__pack_value(&writer, value);
+
+	return json__writer_len(&writer);
+}
+
+size_t json_msgpack_buffer(json_t value, char* buffer, size_t size)
+{
+	json__writer_t writer;
+
+	json__writer_init(&writer, 0, buffer, size, json__flush_fail, NULL);
+	json__pack_value(&writer, value);
+
+	return writer.error ? 0 : json__writer_len(&writer);
+}
+
+int json_msgpack_to_writer(json_t value, json_write_fn write, void* ctx)
+{
+	json__writer_t writer;
+	json__stream_t stream;
+	char buffer[JSON__DUMP_BUFFER];
+
+	stream.write = write;
+	stream.ctx = ctx;
+
+	json__writer_init(&writer, 0, buffer, sizeof(buffer), json__flush_stream, &stream);
+	json__pack_value(&writer, value);
+
+	return !writer.error && json__flush_stream(&writer);
+}
+
+/*	The decoder builds the tree directly, keys are interned like those of the parser.  */
+
+typedef struct json__unpack_t
+{
+	const unsigned char* c;
+	const unsigned char* end;
+	json__dom_t dom;
+
+} json__unpack_t;
+
+/*	Big endian unsigned integer of size bytes  */
+static int json__unpack_uint(json__unpack_t* unpack, int size, json_uint64_t* value)
+{
+	if (unpack->end - unpack->c < size)
+		return 0;
+
+	for (*value = 0; size; size--)
+		*value = (*value << 8) | *unpack->c++;
+
+	return 1;
+}
+
+/*	Length of a str or bin value, 0 if tag is neither or the data is too short  */
+static int json__unpack_len(json__unpack_t* unpack, int tag, size_t* len)
+{
+	json_uint64_t value;
+
+	if (tag >= 0xA0 && tag < 0xC0)
+		value = (json_uint64_t)(tag & 0x1F);
+	else if (tag == 0xD9 || tag == 0xC4)
+	{
+		if (!json__unpack_uint(unpack, 1, &value))
+			return 0;
+	}
+	else if (tag == 0xDA || tag == 0xC5)
+	{
+		if (!json__unpack_uint(unpack, 2, &value))
+			return 0;
+	}
+	else if (tag == 0xDB || tag == 0xC6)
+	{
+		if (!json__unpack_uint(unpack, 4, &value))
+			return 0;
+	}
+	else
+		return 0;
+
+	*len = (size_t)value;
+	return value <= (json_uint64_t)(unpack->end - unpack->c) && value < 0x7FFFFFFF;
+}
+
+static json_t json__unpack_string(json__unpack_t* unpack, size_t len)
+{
+	json_arena_t* arena = unpack->dom.arena;
+	json__string_t* string;
+
+	/* long strings get a buffer of their exact size */
+
+	if (len <= JSON__STRING_INLINE)
+		string = json__string_alloc(arena, len);
+	else if ((string = json__alloc(arena, sizeof(json__string_t))) != NULL)
+	{
+		string->cap = (int)len + 1;
+		string->arena = arena;
+
+		if ((string->data = json__alloc(arena, len + 1)) == NULL)
+		{
+			json__dealloc(arena, string);
+			string = NULL;
+		}
+	}
+
+	if (string == NULL)
+		return json__const_node(JSON_NONE);
+
+	memcpy(string->data, unpack->c, len);
+	string->data[len] = 0;
+	string->len = (int)len;
+	unpack->c += len;
+	return json__node(JSON_STRING, string);
+}
+
+/*	Integers a double represents exactly are stored as double, like those of the parser.  */
+static json_t json__unpack_integer(json__unpack_t* unpack, json_uint64_t bits, int neg)
+{
+	json_int64_t value = (json_int64_t)bits;
+
+	if (neg ? value >= -JSON__EXACT_INT : bits <= (json_uint64_t)JSON__EXACT_INT)
+		return json_number(neg ? (double)value : (double)bits);
+
+	return json__integer_node(unpack->dom.arena,
+		!neg && value < 0 ? JSON_NUMBER_UINT : JSON_NUMBER_INT, bits);
+}
+
+static json_t json__unpack_value(json__unpack_t* unpack, int depth);
+
+static json_t json__unpack_array(json__unpack_t* unpack, json_uint64_t len, int depth)
+{
+	json_t array;
+	json__array_t* arr;
+
+	/* every element takes at least one byte */
+
+	if (depth == JSON_MAX_DEPTH || len > (json_uint64_t)(unpack->end - unpack->c))
+		return json__const_node(JSON_NONE);
+
+	if (JSON__TYPE(array = json__array_node(unpack->dom.arena)) == JSON_NONE)
+		return array;
+
+	arr = JSON__ARR(array);
+
+	if (len && (arr->data = json__alloc(arr->arena, sizeof(json_t) * (size_t)len)) == NULL)
+	{
+		json_free(array);
+		return json__const_node(JSON_NONE);
+	}
+
+	arr->cap = (int)len;
+
+	while (arr->len < (int)len)
+	{
+		json_t value = json__unpack_value(unpack, depth + 1);
+
+		if (JSON__TYPE(value) == JSON_NONE)
+		{
+			json_free(array);
+			return value;
+		}
+
+		arr->data[arr->len++] = value;
+	}
+
+	return array;
+}
+
+static json_t json__unpack_object(json__unpack_t* unpack, json_uint64_t len, int depth)
+{
+	json_t object;
+	json_uint64_t i;
+
+	if (depth == JSON_MAX_DEPTH || len > (json_uint64_t)(unpack->end - unpack->c) / 2)
+		return json__const_node(JSON_NONE);
+
+	if (JSON__TYPE(object = json__object_node(unpack->dom.arena)) == JSON_NONE)
+		return object;
+
+	json__object_reserve(JSON__OBJ(object), (int)len);
+
+	for (i = 0; i < len; i++)
+	{
+		const char* key;
+		json_t value;
+		size_t key_len;
+
+		if (unpack->c == unpack->end || !json__unpack_len(unpack, *unpack->c++, &key_len)
+			|| (key = json__dom_intern(&unpack->dom, (const char*)unpack->c, key_len, 0)) == NULL)
+		{
+			json_free(object);
+			return json__const_node(JSON_NONE);
+		}
+
+		unpack->c += key_len;
+
+		if (JSON__TYPE(value = json__unpack_value(unpack, depth + 1)) == JSON_NONE)
+		{
+			json__key_release(unpack->dom.arena, key);
+			json_free(object);
+			return value;
+		}
+
+		json__object_set(JSON__OBJ(object), key, value, 0);
+	}
+
+	return object;
+}
+
+static json_t json__unpack_value(json__unpack_t* unpack, int depth)
+{
+	json_uint64_t bits;
+	size_t len;
+	int tag, size;
+
+	if (unpack->c == unpack->end)
+		return json__const_node(JSON_NONE);
+
+	tag = *unpack->c++;
+
+	if (tag < 0x80)
+		return json_number(tag);
+
+	if (tag >= 0xE0)
+		return json_number(tag - 0x100);
+
+	if (tag < 0x90)
+		return json__unpack_object(unpack, (json_uint64_t)(tag & 0x0F), depth);
+
+	if (tag < 0xA0)
+		return json__unpack_array(unpack, (json_uint64_t)(tag & 0x0F), depth);
+
+	if (json__unpack_len(unpack, tag, &len))
+		return json__unpack_string(unpack, len);
+
+	switch (tag)
+	{
+	case 0xC0:
+		return json_null();
+
+	case 0xC2:
+	case 0xC3:
+		return json_bool(tag == 0xC3);
+
+	case 0xCA:
+	{
+		unsigned int single_bits;
+		float single;
+
+		if (!json__unpack_uint(unpack, 4, &bits))
+			break;
+
+		single_bits = (unsigned int)bits;
+		memcpy(&single, &single_bits, sizeof(single));
+		return json_number(single);
+	}
+
+	case 0xCB:
+	{
+		double number;
+
+		if (!json__unpack_uint(unpack, 8, &bits))
+			break;
+
+		memcpy(&number, &bits, sizeof(number));
+		return json_number(number);
+	}
+
+	case 0xCC:
+	case 0xCD:
+	case 0xCE:
+	case 0xCF:
+		if (!json__unpack_uint(unpack, 1 << (tag - 0xCC), &bits))
+			break;
+
+		return json__unpack_integer(unpack, bits, 0);
+
+	case 0xD0:
+	case 0xD1:
+	case 0xD2:
+	case 0xD3:
+		size = 1 << (tag - 0xD0);
+
+		if (!json__unpack_uint(unpack, size, &bits))
+			break;
+
+		/* sign extension */
+
+		if (size < 8 && (bits >> (size * 8 - 1)) & 1)
+			bits |= ~((JSON__U64(0, 1) << (size * 8)) - 1);
+
+		return json__unpack_integer(unpack, bits, (json_int64_t)bits < 0);
+
+	case 0xDC:
+	case 0xDD:
+		if (!json__unpack_uint(unpack, tag == 0xDC ? 2 : 4, &bits))
+			break;
+
+		return json__unpack_array(unpack, bits, depth);
+
+	case 0xDE:
+	case 0xDF:
+		if (!json__unpack_uint(unpack, tag == 0xDE ? 2 : 4, &bits))
+			break;
+
+		return json__unpack_object(unpack, bits, depth);
+	}
+
+	/* 0xC1 and extension types */
+
+	return json__const_node(JSON_NONE);
+}
+
+json_t json_msgpack_parse(const char* data, size_t len, json_arena_t* arena)
+{
+	json__unpack_t unpack;
+	json_t value;
+
+	unpack.c = (const unsigned char*)data;
+	unpack.end = unpack.c + len;
+	unpack.dom.depth = -1;
+	unpack.dom.insitu = 0;
+	unpack.dom.key = NULL;
+	unpack.dom.keys = NULL;
+	unpack.dom.keys_len = 0;
+	unpack.dom.keys_cap = 0;
+	unpack.dom.arena = arena;
+
+	value = json__unpack_value(&unpack, 0);
+
+	if (unpack.c != unpack.end)
+	{
+		json_free(value);
+		value = json__const_node(JSON_NONE);
+	}
+
+	json__dom_forget(&unpack.dom);
+	free((void*)unpack.dom.keys);
+	return value;
+}
+
+/**************************************************************************************************
+	JSON Object  */
+
+/*	Objects with up to JSON__LINEAR_MAX keys have no hash index (sparse, hashes and info are NULL),
+	lookups scan the buckets. Larger objects are hashed.  */
+#define JSON__LINEAR_MAX 8
+
+/*	Slots per group of the Swiss table mode, enabled with JSON_OBJECT_SWISS  */
+#define JSON__GROUP 16
+
+static int json__object_cmp(const char* a, const char* b)
+{
+	return strcmp(a, b);
+}
+
+static json__object_t json__object_make(json_arena_t* arena, int len)
+{
+	json__object_t object;
+	int cap = len ? json__next_capacity(len) : 0;
 
-	object.buckets = malloc((sizeof(json_bucket_t) + sizeof(int) + sizeof(char)) * (size_t)cap);
-	object.sparse = (int*)(object.buckets + cap);
-	object.info = (unsigned char*)(object.sparse + cap);
-	object.cap = cap;
 	object.len = 0;
+	object.flags = 0;
+	object.deleted = 0;
+	object.arena = arena;
+
+	if (cap <= JSON__LINEAR_MAX)
+	{
+		object.buckets = cap ? json__alloc(arena, sizeof(json_bucket_t) * (size_t)cap) : NULL;
+		object.sparse = NULL;
+		object.hashes = NULL;
+		object.info = NULL;
+		object.cap = cap;
+		return object;
+	}
+
+#if defined(JSON_OBJECT_SWISS)
+	if (cap < JSON__GROUP)
+		cap = JSON__GROUP;
+#endif
+
+	object.buckets = json__alloc(arena,
+		(sizeof(json_bucket_t) + sizeof(int) + sizeof(int) + sizeof(char)) * (size_t)cap);
+	object.sparse = (int*)(object.buckets + cap);
+	object.hashes = (unsigned int*)(object.sparse + cap);
+	object.info = (unsigned char*)(object.hashes + cap);
+	object.cap = cap;
+
+	memset(object.info, -1, object.cap);
+	return object;
+}
+
+json__object_t json__object_new(int len)
+{
+	return json__object_make(NULL, len);
+}
+
+void json__object_free(json__object_t* object)
+{
+	json__dealloc(object->arena, object->buckets);
+}
+
+#if defined(JSON_OBJECT_SWISS)
+
+/*	Swiss table: info holds a control byte per slot, the low 7 bits of the hash for a used slot,
+	JSON__CTRL_EMPTY or JSON__CTRL_DELETED. Slots are probed in aligned groups of 16 whose control
+	bytes are matched at once, only slots with a matching tag are looked at. Groups are visited in
+	triangular order, which reaches every group once.  */
+
+#define JSON__CTRL_EMPTY 0xFF
+#define JSON__CTRL_DELETED 0x80
+#define JSON__SLOT_USED(object, idx) ((object)->info[idx] < 0x80)
+
+/*	Bit i is set if control byte i equals value.  */
+static unsigned int json__group_match(const unsigned char* ctrl, unsigned char value)
+{
+#if defined(JSON__SSE2)
+	__m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+	return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+#else
+	unsigned int mask = 0;
+	int i;
+
+	for (i = 0; i < JSON__GROUP; i++)
+		mask |= (unsigned int)(ctrl[i] == value) << i;
+
+	return mask;
+#endif
+}
+
+/*	Bit i is set if slot i is empty or deleted.  */
+static unsigned int json__group_free(const unsigned char* ctrl)
+{
+#if defined(JSON__SSE2)
+	return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+#else
+	unsigned int mask = 0;
+	int i;
+
+	for (i = 0; i < JSON__GROUP; i++)
+		mask |= (unsigned int)(ctrl[i] >> 7) << i;
+
+	return mask;
+#endif
+}
+
+static void json__object_index(json__object_t* object, int bucket, unsigned int hash)
+{
+	int mask = object->cap / JSON__GROUP - 1;
+	int group = (int)(hash >> 7) & mask;
+	int step;
+
+	for (step = 1;; group = (group + step++) & mask)
+	{
+		unsigned int slots = json__group_free(object->info + group * JSON__GROUP);
+
+		if (slots)
+		{
+			int idx = group * JSON__GROUP + json__ctz(slots);
+
+			if (object->info[idx] == JSON__CTRL_DELETED)
+				object->deleted--;
+
+			object->sparse[idx] = bucket;
+			object->hashes[idx] = hash;
+			object->info[idx] = (unsigned char)(hash & 0x7F);
+			return;
+		}
+	}
+}
+
+static json_t* json__object_probe(json__object_t* object, const char* key, unsigned int hash,
+	int* out_index)
+{
+	int mask = object->cap / JSON__GROUP - 1;
+	int group = (int)(hash >> 7) & mask;
+	int step;
+
+	for (step = 1; step <= mask + 1; group = (group + step++) & mask)
+	{
+		const unsigned char* ctrl = object->info + group * JSON__GROUP;
+		unsigned int match = json__group_match(ctrl, (unsigned char)(hash & 0x7F));
+
+		for (; match; match &= match - 1)
+		{
+			int idx = group * JSON__GROUP + json__ctz(match);
+			json_bucket_t* bucket = object->buckets + object->sparse[idx];
+
+			if (bucket->key == key || json__object_cmp(key, bucket->key) == 0)
+			{
+				*out_index = idx;
+				return &bucket->val;
+			}
+		}
+
+		/* a key is never stored behind a group with an empty slot */
+		if (json__group_match(ctrl, JSON__CTRL_EMPTY))
+			break;
+	}
+
+	return NULL;
+}
+
+/*	A slot can only become empty again if its group never filled up, otherwise keys behind the
+	group would no longer be found. Deleted slots are counted, they end probes as late as used
+	ones.  */
+static void json__object_unindex(json__object_t* object, int idx)
+{
+	const unsigned char* ctrl = object->info + (idx & ~(JSON__GROUP - 1));
+
+	if (json__group_match(ctrl, JSON__CTRL_EMPTY))
+		object->info[idx] = JSON__CTRL_EMPTY;
+	else
+	{
+		object->info[idx] = JSON__CTRL_DELETED;
+		object->deleted++;
+	}
+}
+
+#else
+
+#define JSON__SLOT_USED(object, idx) ((object)->info[idx] != 0xFF)
+
+/*	Insert bucket into the index (Robin Hood hashing). Slots store the hash of their key, so keys
+	are only compared when the hashes match and growing never hashes a key again.  */
+static void json__object_index(json__object_t* object, int bucket, unsigned int hash)
+{
+	int mask = object->cap - 1;
+	int idx = (int)(hash & mask);
+	int distance = 0;
+
+	for (;; idx = (idx + 1) & mask, distance++)
+	{
+		int _distance = object->info[idx];
+
+		if (_distance == 0xFF)
+		{
+			object->sparse[idx] = bucket;
+			object->hashes[idx] = hash;
+			object->info[idx] = (unsigned char)distance;
+			return;
+		}
+		else if (distance > _distance)
+		{
+			int tmp_bucket = object->sparse[idx];
+			unsigned int tmp_hash = object->hashes[idx];
+
+			object->sparse[idx] = bucket;
+			object->hashes[idx] = hash;
+			object->info[idx] = (unsigned char)distance;
+
+			bucket = tmp_bucket;
+			hash = tmp_hash;
+			distance = _distance;
+		}
+	}
+}
+
+static json_t* json__object_probe(json__object_t* object, const char* key, unsigned int hash,
+	int* out_index)
+{
+	int mask = object->cap - 1;
+	int idx = (int)(hash & mask);
+	int distance = 0;
+
+	for (;; idx = (idx + 1) & mask, distance++)
+	{
+		json_bucket_t* bucket;
+		int _distance = object->info[idx];
+
+		if ((_distance == 0xFF) | (distance > _distance))
+		{
+			*out_index = idx;
+			return NULL;
+		}
+
+		if (object->hashes[idx] != hash)
+			continue;
+
+		bucket = object->buckets + object->sparse[idx];
+
+		/* interned keys are found by their address */
+		if (bucket->key == key || json__object_cmp(key, bucket->key) == 0)
+		{
+			*out_index = idx;
+			return &bucket->val;
+		}
+	}
+}
+
+/*	Remove slot idx, the following slots of the cluster move back by one.  */
+static void json__object_unindex(json__object_t* object, int idx)
+{
+	int mask = object->cap - 1, next;
+
+	for (next = (idx + 1) & mask;; idx = next, next = (next + 1) & mask)
+	{
+		int next_distance = object->info[next];
+		if ((next_distance == 0xFF) | (next_distance == 0))
+		{
+			object->info[idx] = 0xFF;
+			break;
+		}
+
+		object->sparse[idx] = object->sparse[next];
+		object->hashes[idx] = object->hashes[next];
+		object->info[idx] = next_distance - 1;
+	}
+}
+
+#endif
+
+/*	Hash of a key in the object, taken from the key header unless the key is borrowed.  */
+static unsigned int json__object_key_hash(json__object_t* object, const char* key)
+{
+	if (object->flags & JSON__BORROWED_KEYS)
+		return json__key_hash(key, strlen(key));
+
+	return JSON__KEY(key)->hash;
+}
+
+/*	Linear mode lookup, out_index is the bucket index. The first byte rejects most keys.  */
+static json_t* json__object_scan(json__object_t* object, const char* key, int* out_index)
+{
+	int i;
+
+	for (i = 0; i < object->len; i++)
+	{
+		json_bucket_t* bucket = object->buckets + i;
+
+		if (bucket->key == key || (bucket->key[0] == key[0]
+			&& json__object_cmp(key, bucket->key) == 0))
+		{
+			*out_index = i;
+			return &bucket->val;
+		}
+	}
+
+	return NULL;
+}
+
+/*	out_index is the slot of the key, or the bucket index in linear mode. hash is not used in
+	linear mode.  */
+json_t* json__object_get_index(json__object_t* object, const char* key, unsigned int hash,
+	int* out_index)
+{
+	if (object->sparse == NULL)
+		return json__object_scan(object, key, out_index);
+
+	return json__object_probe(object, key, hash, out_index);
+}
+
+/*	Buckets keep their order, only the index is rebuilt.  */
+static void json__object_move(json__object_t* dst, json__object_t* src)
+{
+	int i;
+
+	dst->flags = src->flags;
+	dst->len = src->len;
+
+	if (src->len)
+		memcpy(dst->buckets, src->buckets, sizeof(json_bucket_t) * (size_t)src->len);
+
+	if (dst->sparse && src->sparse)
+	{
+		for (i = 0; i < src->cap; i++)
+		{
+			if (JSON__SLOT_USED(src, i))
+				json__object_index(dst, src->sparse[i], src->hashes[i]);
+		}
+	}
+	else if (dst->sparse)
+	{
+		for (i = 0; i < src->len; i++)
+			json__object_index(dst, i, json__object_key_hash(src, src->buckets[i].key));
+	}
+
+	json__object_free(src);
+	*src = *dst;
+}
+
+/*	Rebuild the index at the same capacity, which drops the deleted slots.  */
+static void json__object_rehash(json__object_t* object)
+{
+	int i;
+
+	memset(object->info, -1, (size_t)object->cap);
+	object->deleted = 0;
+
+	for (i = 0; i < object->len; i++)
+		json__object_index(object, i, json__object_key_hash(object, object->buckets[i].key));
+}
+
+/*	Deleted slots of the Swiss table count towards the load. If they outnumber the keys the index
+	is rebuilt in place instead of growing.  */
+void json__object_reserve(json__object_t* object, int len)
+{
+	int limit = object->sparse ? object->cap - (object->cap / 4) : object->cap;
+
+	if (len + object->deleted <= limit)
+		return;
+
+	if (object->deleted >= len)
+		json__object_rehash(object);
+	else
+	{
+		json__object_t new_object = json__object_make(object->arena,
+			len > JSON__LINEAR_MAX ? len * 2 : len);
+		json__object_move(&new_object, object);
+	}
+}
+
+void json__object_trim(json__object_t* object)
+{
+	if (object->sparse && (object->cap / 4) > object->len)
+	{
+		json__object_t new_object = json__object_make(object->arena, object->len);
+		json__object_move(&new_object, object);
+	}
+}
+
+/*	Copy borrowed keys before the object is changed, so every key has the same owner.  */
+static void json__object_own_keys(json__object_t* object)
+{
+	int i;
+
+	if (!(object->flags & JSON__BORROWED_KEYS) || object->arena)
+		return;
+
+	for (i = 0; i < object->len; i++)
+	{
+		json_bucket_t* bucket = object->buckets + i;
+		size_t len = strlen(bucket->key);
+		char* key = json__key_new(NULL, bucket->key, len, json__key_hash(bucket->key, len));
+
+		if (key == NULL)
+			return;
+
+		bucket->key = key;
+	}
+
+	object->flags &= ~JSON__BORROWED_KEYS;
+}
+
+/*	Without copy_key the object takes over key, which has a header unless the object borrows its
+	keys.  */
+void json__object_set(json__object_t* object, const char* key, json_t value, int copy_key)
+{
+	unsigned int hash = 0;
+	int idx;
+	json_t* val;
+	json_bucket_t* bucket;
+
+	json__object_reserve(object, object->len + 1);
+
+	if (copy_key)
+		hash = json__key_hash(key, strlen(key));
+	else if (object->sparse)
+		hash = json__object_key_hash(object, key);
+
+	val = json__object_get_index(object, key, hash, &idx);
+
+	if (val != NULL)
+	{
+		/* a duplicate key handed over by the parser is not needed */
+		if (!copy_key && !(object->flags & JSON__BORROWED_KEYS))
+			json__key_release(object->arena, key);
+
+		json_free(*val);
+		*val = value;
+		return;
+	}
+
+	if (copy_key)
+	{
+		json__object_own_keys(object);
+		key = json__key_new(object->arena, key, strlen(key), hash);
+	}
+
+	bucket = object->buckets + object->len;
+	bucket->key = key;
+	bucket->val = value;
+
+	if (object->sparse)
+		json__object_index(object, object->len, hash);
+
+	object->len++;
+}
+
+json_t json_object_get(json_t object, const char* key)
+{
+	int idx;
+	unsigned int hash;
+	json_t* val, none = json__const_node(JSON_NONE);
+
+	assert(JSON__TYPE(object) == JSON_OBJECT);
+	hash = JSON__OBJ(object)->sparse ? json__key_hash(key, strlen(key)) : 0;
+	val = json__object_get_index(JSON__OBJ(object), key, hash, &idx);
+
+	if (val)
+		return *val;
+
+	return none;
+}
+
+void json_object_set(json_t object, const char* key, json_t value)
+{
+	assert(JSON__TYPE(object) == JSON_OBJECT);
+	json__object_set(JSON__OBJ(object), key, value, 1);
+}
+
+json_t json_object_pop(json_t object, const char* key)
+{
+	unsigned int hash;
+	int idx, removed, i;
+	json_bucket_t* start, * end;
+	json__object_t* obj = JSON__OBJ(object);
+	json_t val = json__const_node(JSON_NONE);
+
+	assert(JSON__TYPE(object) == JSON_OBJECT);
+	hash = obj->sparse ? json__key_hash(key, strlen(key)) : 0;
+
+	if (json__object_get_index(obj, key, hash, &idx) == NULL)
+		return val;
 
-	memset(object.info, -1, object.cap);
-	return object;
+	removed = obj->sparse ? obj->sparse[idx] : idx;
+	start = obj->buckets + removed;
+	end = obj->buckets + obj->len;
+
+	if (!(obj->flags & JSON__BORROWED_KEYS))
+		json__key_release(obj->arena, start->key);
+
+	val = start->val;
+	memmove(start, start + 1, (size_t)(end - start - 1) * sizeof(json_bucket_t));
+
+	obj->len--;
+
+	if (obj->sparse == NULL)
+		return val;
+
+	/* buckets behind the removed one moved down */
+
+	for (i = 0; i < obj->cap; i++)
+	{
+		if (JSON__SLOT_USED(obj, i) && obj->sparse[i] > removed)
+			obj->sparse[i]--;
+	}
+
+	json__object_unindex(obj, idx);
+	json__object_trim(obj);
+	return val;
 }
 
-void json__object_free(json__object_t* object)
+int json_object_erase(json_t object, const char* key)
 {
-	free(object->buckets);
+	json_t val = json_object_pop(object, key);
+	json_free(val);
+
+	return JSON__TYPE(val) != JSON_NONE;
 }
 
-static void json__object_move(json__object_t* dst, json__object_t* src)
+int json_object_len(json_t object)
 {
-	int i;
-	for (i = 0; i < src->len; i++)
+	assert(JSON__TYPE(object) == JSON_OBJECT);
+	return JSON__OBJ(object)->len;
+}
+
+json_bucket_t* json_object_begin(json_t object)
+{
+	assert(JSON__TYPE(object) == JSON_OBJECT);
+	return JSON__OBJ(object)->buckets;
+}
+
+json_bucket_t* json_object_end(json_t object)
+{
+	assert(JSON__TYPE(object) == JSON_OBJECT);
+	return JSON__OBJ(object)->buckets + JSON__OBJ(object)->len;
+}
+
+json_bucket_t* json_object_at(json_t object, int index)
+{
+	assert(JSON__TYPE(object) == JSON_OBJECT && index < JSON__OBJ(object)->len);
+	return JSON__OBJ(object)->buckets + index;
+}
+
+/**************************************************************************************************
+	JSON Array  */
+
+static json__array_t json__array_make(json_arena_t* arena, int len)
+{
+	json__array_t array = { NULL, 0, 0, NULL };
+	array.arena = arena;
+	json__array_reserve(&array, len);
+	return array;
+}
+
+json__array_t json__array_new(int len)
+{
+	return json__array_make(NULL, len);
+}
+
+void json__array_free(json__array_t* array)
+{
+	json__dealloc(array->arena, array->data);
+}
+
+void json__array_reserve(json__array_t* array, int len)
+{
+	if (array->cap < len)
+	{
+		json_t* new_data;
+
+		len = json__next_capacity(len);
+		new_data = json__alloc(array->arena, sizeof(json_t) * (size_t)len);
+		array->cap = len;
+
+		if (array->len)
+			memcpy(new_data, array->data, (size_t)array->len * sizeof(json_t));
+
+		json__array_free(array);
+		array->data = new_data;
+	}
+}
+
+void json__array_trim(json__array_t* array)
+{
+	if (array->arena == NULL && (array->cap / 4) > array->len)
 	{
-		json_bucket_t* bucket = src->buckets + i;
-		json__object_set(dst, bucket->key, bucket->val, 0);
+		array->cap = json__next_capacity(array->len * 2);
+		array->data = realloc(array->data, (size_t)array->cap * sizeof(json_t));
 	}
+}
 
-	json__object_free(src);
-	*src = *dst;
+json_t json_array_get(json_t array, int index)
+{
+	assert(JSON__TYPE(array) == JSON_ARRAY && index < JSON__ARR(array)->len);
+	return JSON__ARR(array)->data[index];
 }
 
-void json__object_reserve(json__object_t* object, int len)
+void json_array_set(json_t array, int index, json_t value)
+{
+	json_t* _node;
+
+	assert(JSON__TYPE(array) == JSON_ARRAY && index < JSON__ARR(array)->len);
+	_node = JSON__ARR(array)->data + index;
+
+	json_free(*_node);
+	*_node = value;
+}
+
+void json_array_insert(json_t array, int index, json_t value)
+{
+	json__array_t* arr = JSON__ARR(array);
+	json_t* dst, * src;
+
+	assert(JSON__TYPE(array) == JSON_ARRAY && index <= JSON__ARR(array)->len);
+
+	json__array_reserve(arr, arr->len + 1);
+	src = arr->data + index;
+	dst = src + 1;
+	memmove(dst, src, (size_t)(arr->len - index) * sizeof(json_t));
+	*src = value;
+	arr->len++;
+}
+
+void json_array_push(json_t array, json_t value)
+{
+	assert(JSON__TYPE(array) == JSON_ARRAY);
+	json_array_insert(array, JSON__ARR(array)->len, value);
+}
+
+json_t json_array_pop(json_t array, int index)
+{
+	json__array_t* arr = JSON__ARR(array);
+	json_t* src, * dst, val = json__const_node(JSON_NONE);
+
+	assert(JSON__TYPE(array) == JSON_ARRAY && index < JSON__ARR(array)->len);
+
+	arr->len--;
+	dst = arr->data + index;
+	src = dst + 1;
+	val = *dst;
+
+	memmove(dst, src, (size_t)(arr->len - index) * sizeof(json_t));
+	json__array_trim(arr);
+	return val;
+}
+
+void json_array_erase(json_t array, int index)
+{
+	json_t val = json_array_pop(array, index);
+	json_free(val);
+}
+
+int json_array_len(json_t array)
 {
-	if (len > (object->cap - (object->cap / 4)))
+	assert(JSON__TYPE(array) == JSON_ARRAY);
+	return JSON__ARR(array)->len;
+}
+
+json_t* json_array_begin(json_t array)
+{
+	assert(JSON__TYPE(array) == JSON_ARRAY);
+	return JSON__ARR(array)->data;
+}
+
+json_t* json_array_end(json_t array)
+{
+	assert(JSON__TYPE(array) == JSON_ARRAY);
+	return JSON__ARR(array)->data + JSON__ARR(array)->len;
+}
+
+json_t* json_array_at(json_t array, int index)
+{
+	assert(JSON__TYPE(array) == JSON_ARRAY && index < JSON__ARR(array)->len);
+	return JSON__ARR(array)->data + index;
+}
+
+/**************************************************************************************************
+	JSON Pointer  */
+
+/*	Segments are unescaped and hashed when the pointer is compiled. The pointer, its segments and
+	their keys are one allocation.  */
+
+json_pointer_t* json_pointer_compile(const char* pointer)
+{
+	json_pointer_t* result;
+	const char* c;
+	char* key;
+	size_t len = strlen(pointer);
+	int steps = 0;
+
+	if (*pointer && *pointer != '/')
+		return NULL;
+
+	for (c = pointer; *c; c++)
 	{
-		json__object_t new_object = json__object_new(len * 2);
-		json__object_move(&new_object, object);
+		if (*c == '/')
+			steps++;
+		else if (*c == '~' && c[1] != '0' && c[1] != '1')
+			return NULL;
+	}
+
+	result = malloc(sizeof(json_pointer_t) + sizeof(json__pointer_step_t) * (size_t)steps + len);
+
+	if (result == NULL)
+		return NULL;
+
+	result->steps = (json__pointer_step_t*)(result + 1);
+	result->len = steps;
+	key = (char*)(result->steps + steps);
+
+	for (c = pointer, steps = 0; *c; steps++)
+	{
+		json__pointer_step_t* step = result->steps + steps;
+
+		step->key = key;
+
+		for (c++; *c && *c != '/'; c++)
+		{
+			if (*c == '~')
+				*key++ = *++c == '0' ? '~' : '/';
+			else
+				*key++ = *c;
+		}
+
+		*key++ = 0;
+		step->len = (int)(key - 1 - step->key);
+		step->hash = json__key_hash(step->key, (size_t)step->len);
+		step->index = -1;
+
+		/* array indices are "0" or have no leading zero */
+
+		if (step->len > 0 && step->len < 10 && (step->key[0] != '0' || step->len == 1))
+		{
+			int i, index = 0;
+
+			for (i = 0; i < step->len && step->key[i] >= '0' && step->key[i] <= '9'; i++)
+				index = index * 10 + (step->key[i] - '0');
+
+			if (i == step->len)
+				step->index = index;
+		}
 	}
+
+	return result;
 }
 
-void json__object_trim(json__object_t* object)
+void json_pointer_free(json_pointer_t* pointer)
+{
+	free(pointer);
+}
+
+/*	Lookup with a precomputed hash. Hashed objects compare the hash of every slot, linear objects
+	the hash in the key header.  */
+static json_t* json__object_find(json__object_t* object, const json__pointer_step_t* step)
 {
-	if ((object->cap - (object->cap - (object->cap / 4))) > object->len)
+	int i;
+
+	if (object->sparse)
+		return json__object_probe(object, step->key, step->hash, &i);
+
+	for (i = 0; i < object->len; i++)
 	{
-		json__object_t new_object = json__object_new(object->len);
-		json__object_move(&new_object, object);
+		json_bucket_t* bucket = object->buckets + i;
+
+		if (object->flags & JSON__BORROWED_KEYS)
+		{
+			if (bucket->key[0] == step->key[0] && strcmp(bucket->key, step->key) == 0)
+				return &bucket->val;
+		}
+		else if (JSON__KEY(bucket->key)->hash == step->hash
+			&& JSON__KEY(bucket->key)->len == step->len
+			&& memcmp(bucket->key, step->key, (size_t)step->len) == 0)
+			return &bucket->val;
 	}
+
+	return NULL;
 }
 
-json_t* json__object_get_index(json__object_t* object, const char* key, int hash, int* out_index)
+json_t json_pointer_get(json_t value, const json_pointer_t* pointer)
 {
-	int mask = object->cap - 1;
-	int idx = hash & mask;
-	int distance = 0;
+	int i;
 
-	for (;; idx = (idx + 1) & mask, distance++)
+	for (i = 0; i < pointer->len; i++)
 	{
-		json_bucket_t* bucket;
-		int _distance = object->info[idx];
+		const json__pointer_step_t* step = pointer->steps + i;
 
-		if ((_distance == 0xFF) | (distance > _distance))
+		if (JSON__TYPE(value) == JSON_OBJECT)
 		{
-			*out_index = idx;
-			return NULL;
+			json_t* member = json__object_find(JSON__OBJ(value), step);
+
+			if (member == NULL)
+				return json__const_node(JSON_NONE);
+
+			value = *member;
 		}
+		else if (JSON__TYPE(value) == JSON_ARRAY && step->index >= 0
+			&& step->index < JSON__ARR(value)->len)
+			value = JSON__ARR(value)->data[step->index];
+		else
+			return json__const_node(JSON_NONE);
+	}
 
-		bucket = object->buckets + object->sparse[idx];
+	return value;
+}
+
+/**************************************************************************************************
+	JSON Snapshot  */
+
+/*	A snapshot is one relocatable buffer that is read where it lies, straight from a mapped file.
+	Values are 64 bit words boxed like JSON_NAN_BOXING, but the payload of an object, array,
+	string or integer is its byte offset from the start of the snapshot. Records are aligned to
+	8 bytes:
+
+	header   "JSNP", version, seed, root value, size
+	object   len, cap, len * (key offset, value), more than JSON__LINEAR_MAX members are followed
+	         by a Robin Hood index: sparse[cap], hashes[cap], info[cap]
+	array    len, 0, len * value
+	string   len, characters, 0
+	integer  bits, num_type
+
+	Keys are strings, a key used by several objects of the document is stored once. The index
+	holds the hashes of the keys with the seed of the header, lookups hash with the same seed.  */
+
+#define JSON__SNAPSHOT_VERSION 1
+
+typedef struct json__snapshot_header_t
+{
+	char magic[4];
+	unsigned int version;
+	json_uint64_t seed;
+	json_uint64_t root;
+	json_uint64_t size;
+
+} json__snapshot_header_t;
+
+/*	Keys written so far by hash, used while writing  */
+typedef struct json__snapshot_key_t
+{
+	size_t offset;
+	unsigned int hash;
+
+} json__snapshot_key_t;
 
-		if (json__object_cmp(key, bucket->key) == 0)
+typedef struct json__snapshot_t
+{
+	char* data;
+	size_t len;
+	size_t cap;
+
+	json__snapshot_key_t* keys;
+	size_t keys_len;
+	size_t keys_cap;
+
+	int error;
+
+} json__snapshot_t;
+
+#define JSON__SNAPSHOT_WORD(type, offset) \
+	(((json_uint64_t)(JSON__BOX_TAG + (type)) << 48) | (json_uint64_t)(offset))
+#define JSON__SNAPSHOT_CONST(type) (((json_uint64_t)JSON__BOX_CONST << 48) | (json_uint64_t)(type))
+
+/*	Reserve a zeroed record, returns its offset. Containers reserve their record before the
+	children are written and fill it in by offset, the buffer may move in between.  */
+static size_t json__snapshot_alloc(json__snapshot_t* snap, size_t size)
+{
+	size_t offset = snap->len;
+	size_t len = (offset + size + 7) & ~(size_t)7;
+
+	if (snap->error)
+		return 0;
+
+	if (len > snap->cap)
+	{
+		size_t cap = snap->cap * 2 > len ? snap->cap * 2 : len;
+		char* data = (json_uint64_t)len > JSON__BOX_PAYLOAD ? NULL : realloc(snap->data, cap);
+
+		if (data == NULL)
 		{
-			*out_index = idx;
-			return &bucket->val;
+			snap->error = 1;
+			return 0;
 		}
+
+		snap->data = data;
+		snap->cap = cap;
 	}
+
+	memset(snap->data + offset, 0, len - offset);
+	snap->len = len;
+	return offset;
 }
 
-void json__object_set(json__object_t* object, const char* key, json_t value, int copy_key)
+static size_t json__snapshot_string(json__snapshot_t* snap, const char* str, size_t len)
 {
-	int mask, hash, idx, distance, tmp;
-	json_t* val;
-	char* name;
+	size_t offset = json__snapshot_alloc(snap, sizeof(unsigned int) + len + 1);
 
-	json__object_reserve(object, object->len + 1);
+	if (snap->error)
+		return 0;
 
-	hash = json__object_hash(key);
-	val = json__object_get_index(object, key, hash, &idx);
+	*(unsigned int*)(snap->data + offset) = (unsigned int)len;
+	memcpy(snap->data + offset + sizeof(unsigned int), str, len);
+	return offset;
+}
 
-	if (val != NULL)
+/*	Equal keys are written once, whether they are interned or not  */
+static size_t json__snapshot_key(json__snapshot_t* snap, const char* key, size_t len,
+	unsigned int hash)
+{
+	size_t mask, i;
+
+	if (snap->keys_len * 2 >= snap->keys_cap)
 	{
-		json_free(*val);
-		*val = value;
-		return;
+		size_t cap = snap->keys_cap ? snap->keys_cap * 2 : 256;
+		json__snapshot_key_t* keys = calloc(cap, sizeof(json__snapshot_key_t));
+
+		if (keys == NULL)
+		{
+			snap->error = 1;
+			return 0;
+		}
+
+		for (i = 0; i < snap->keys_cap; i++)
+		{
+			size_t idx = snap->keys[i].hash & (cap - 1);
+
+			if (snap->keys[i].offset == 0)
+				continue;
+
+			while (keys[idx].offset)
+				idx = (idx + 1) & (cap - 1);
+
+			keys[idx] = snap->keys[i];
+		}
+
+		free(snap->keys);
+		snap->keys = keys;
+		snap->keys_cap = cap;
 	}
 
-	if (copy_key)
+	mask = snap->keys_cap - 1;
+
+	for (i = hash & mask; snap->keys[i].offset; i = (i + 1) & mask)
 	{
-		tmp = (int)strlen(key) + 1;
-		name = memcpy(malloc(tmp), key, tmp);
+		const char* other = snap->data + snap->keys[i].offset;
+
+		if (snap->keys[i].hash == hash && *(const unsigned int*)other == len
+			&& memcmp(other + sizeof(unsigned int), key, len) == 0)
+			return snap->keys[i].offset;
 	}
-	else
-		name = (char*)key;
 
-	mask = object->cap - 1;
-	distance = ((object->cap + idx) - (hash & mask)) & mask;
+	/* offset 0 is the header, it marks empty entries */
+
+	snap->keys[i].offset = json__snapshot_string(snap, key, len);
+	snap->keys[i].hash = hash;
+	snap->keys_len++;
+	return snap->keys[i].offset;
+}
+
+/*	Same insertion as the Robin Hood index of objects, the slots are in the snapshot.  */
+static void json__snapshot_index(char* record, unsigned int cap, unsigned int bucket,
+	unsigned int hash)
+{
+	unsigned int* sparse = (unsigned int*)(record + 8 + 16 * (size_t)*(unsigned int*)record);
+	unsigned int* hashes = sparse + cap;
+	unsigned char* info = (unsigned char*)(hashes + cap);
+	unsigned int mask = cap - 1, idx = hash & mask;
+	int distance = 0;
 
-	for (tmp = -1;; idx = (idx + 1) & mask, distance++)
+	for (;; idx = (idx + 1) & mask, distance++)
 	{
-		int _distance = object->info[idx];
+		int _distance = info[idx];
+
 		if (_distance == 0xFF)
 		{
-			if (tmp == -1)
-			{
-				/* Add bucket to buckets */
-				json_bucket_t* bucket = object->buckets + object->len;
-				bucket->key = name;
-				bucket->val = value;
-				object->sparse[idx] = object->len++;
-			}
-			else
-				/* Replace index */
-				object->sparse[idx] = tmp;
-
-			object->info[idx] = distance;
+			sparse[idx] = bucket;
+			hashes[idx] = hash;
+			info[idx] = (unsigned char)distance;
 			return;
 		}
 		else if (distance > _distance)
 		{
-			int tmp_x = object->sparse[idx];
-			if (tmp == -1)
-			{
-				/* Add bucket to buckets */
-				json_bucket_t* bucket = object->buckets + object->len;
-				bucket->key = name;
-				bucket->val = value;
-				object->sparse[idx] = object->len++;
-			}
-			else
-				/* Replace index */
-				object->sparse[idx] = tmp;
+			unsigned int tmp_bucket = sparse[idx];
+			unsigned int tmp_hash = hashes[idx];
 
-			tmp = tmp_x;
-			object->info[idx] = distance;
+			sparse[idx] = bucket;
+			hashes[idx] = hash;
+			info[idx] = (unsigned char)distance;
+
+			bucket = tmp_bucket;
+			hash = tmp_hash;
 			distance = _distance;
 		}
 	}
 }
 
-json_t json_object_get(json_t object, const char* key)
+static json_uint64_t json__snapshot_value(json__snapshot_t* snap, json_t value)
 {
-	int idx;
-	json_t* val, none = { JSON_NONE };
+	size_t offset;
+	int i;
 
-	assert(object.type == JSON_OBJECT);
-	val = json__object_get_index(object.u.obj, key, json__object_hash(key), &idx);
+	switch (JSON__TYPE(value))
+	{
+	case JSON_OBJECT:
+	{
+		json__object_t* object = JSON__OBJ(value);
+		unsigned int cap = object->len > JSON__LINEAR_MAX ?
+			(unsigned int)json__next_capacity(object->len * 2) : 0;
 
-	if (val)
-		return *val;
+		offset = json__snapshot_alloc(snap, 8 + 16 * (size_t)object->len
+			+ (sizeof(unsigned int) * 2 + 1) * (size_t)cap);
 
-	return none;
-}
+		if (snap->error)
+			return 0;
 
-void json_object_set(json_t object, const char* key, json_t value)
-{
-	assert(object.type == JSON_OBJECT);
-	json__object_set(object.u.obj, key, value, 1);
-}
+		((unsigned int*)(snap->data + offset))[0] = (unsigned int)object->len;
+		((unsigned int*)(snap->data + offset))[1] = cap;
 
-json_t json_object_pop(json_t object, const char* key)
-{
-	int hash, idx, mask, next;
-	json_bucket_t* start, * end;
-	json__object_t* obj = object.u.obj;
-	json_t val = { JSON_NONE };
+		if (cap)
+			memset(snap->data + offset + 8 + 16 * (size_t)object->len + 8 * (size_t)cap, 0xFF,
+				cap);
 
-	assert(object.type == JSON_OBJECT);
-	hash = json__object_hash(key);
+		for (i = 0; i < object->len && !snap->error; i++)
+		{
+			json_bucket_t* bucket = object->buckets + i;
+			unsigned int hash = json__object_key_hash(object, bucket->key);
+			size_t key = json__snapshot_key(snap, bucket->key, json__key_len(object, bucket->key),
+				hash);
+			json_uint64_t word = json__snapshot_value(snap, bucket->val);
 
-	if (json__object_get_index(obj, key, hash, &idx) == NULL)
-		return val;
+			if (snap->error)
+				break;
 
-	start = obj->buckets + obj->sparse[idx];
-	end = obj->buckets + obj->len;
+			((json_uint64_t*)(snap->data + offset + 8))[i * 2] = (json_uint64_t)key;
+			((json_uint64_t*)(snap->data + offset + 8))[i * 2 + 1] = word;
 
-	free((void*)start->key);
-	val = start->val;
-	memmove(start, start + 1, (size_t)end - (size_t)start);
+			if (cap)
+				json__snapshot_index(snap->data + offset, cap, (unsigned int)i, hash);
+		}
 
-	obj->len--;
-	mask = obj->cap - 1;
+		return JSON__SNAPSHOT_WORD(JSON_OBJECT, offset);
+	}
+	case JSON_ARRAY:
+	{
+		json__array_t* array = JSON__ARR(value);
 
-	for (next = (idx + 1) & mask;; idx = next, next = (next + 1) & mask)
+		offset = json__snapshot_alloc(snap, 8 + 8 * (size_t)array->len);
+
+		if (snap->error)
+			return 0;
+
+		*(unsigned int*)(snap->data + offset) = (unsigned int)array->len;
+
+		for (i = 0; i < array->len && !snap->error; i++)
+		{
+			json_uint64_t word = json__snapshot_value(snap, array->data[i]);
+			((json_uint64_t*)(snap->data + offset + 8))[i] = word;
+		}
+
+		return JSON__SNAPSHOT_WORD(JSON_ARRAY, offset);
+	}
+	case JSON_STRING:
+		offset = json__snapshot_string(snap, JSON__STR(value)->data,
+			(size_t)JSON__STR(value)->len);
+		return JSON__SNAPSHOT_WORD(JSON_STRING, offset);
+	case JSON_NUMBER:
 	{
-		int next_distance = obj->info[next];
-		if ((next_distance == 0xFF) | (next_distance == 0))
+		double num;
+		json_uint64_t bits;
+
+		if (json_number_type(value) != JSON_NUMBER_REAL)
 		{
-			obj->info[idx] = 0xFF;
-			break;
+			offset = json__snapshot_alloc(snap, 16);
+
+			if (snap->error)
+				return 0;
+
+			((json_uint64_t*)(snap->data + offset))[0] = json_uinteger_value(value);
+			((json_uint64_t*)(snap->data + offset))[1] = (json_uint64_t)json_number_type(value);
+			return JSON__SNAPSHOT_WORD(JSON_NUMBER, offset);
 		}
 
-		obj->sparse[idx] = obj->sparse[next];
-		obj->info[idx] = next_distance - 1;
+		/* every NaN is stored as the positive quiet NaN so it never collides with a tag */
+
+		num = json_number_value(value);
+
+		if (num != num)
+			return JSON__BOX_NAN;
+
+		memcpy(&bits, &num, sizeof(bits));
+		return bits;
+	}
 	}
 
-	json__object_trim(obj);
-	return val;
+	return JSON__SNAPSHOT_CONST(JSON__TYPE(value));
 }
 
-int json_object_erase(json_t object, const char* key)
+char* json_snapshot(json_t value, size_t* len)
 {
-	json_t val = json_object_pop(object, key);
-	json_free(val);
+	json__snapshot_t snap;
+	json__snapshot_header_t* header;
+	json_uint64_t root;
 
-	return val.type != JSON_NONE;
-}
+	json__tables();
+	memset(&snap, 0, sizeof(snap));
+	json__snapshot_alloc(&snap, sizeof(json__snapshot_header_t));
+	root = json__snapshot_value(&snap, value);
+	free(snap.keys);
 
-int json_object_len(json_t object)
-{
-	assert(object.type == JSON_OBJECT);
-	return object.u.obj->len;
+	if (snap.error)
+	{
+		free(snap.data);
+		return NULL;
+	}
+
+	header = (json__snapshot_header_t*)snap.data;
+	memcpy(header->magic, "JSNP", 4);
+	header->version = JSON__SNAPSHOT_VERSION;
+	header->seed = json__seed;
+	header->root = root;
+	header->size = snap.len;
+
+	if (len)
+		*len = snap.len;
+
+	return snap.data;
 }
 
-json_bucket_t* json_object_begin(json_t object)
+static json_snapshot_value_t json__snapshot_at(const char* data, json_uint64_t word)
 {
-	assert(object.type == JSON_OBJECT);
-	return object.u.obj->buckets;
+	json_snapshot_value_t value;
+	value.data = data;
+	value.word = word;
+	return value;
 }
 
-json_bucket_t* json_object_end(json_t object)
+static const char* json__snapshot_record(json_snapshot_value_t value)
 {
-	assert(object.type == JSON_OBJECT);
-	return object.u.obj->buckets + object.u.obj->len;
+	return value.data + (size_t)(value.word & JSON__BOX_PAYLOAD);
 }
 
-json_bucket_t* json_object_at(json_t object, int index)
+/*	Only the header is checked so opening a snapshot costs nothing, the records are trusted. The
+	version is read in the byte order of the machine, snapshots of the other order are refused.  */
+json_snapshot_value_t json_snapshot_root(const char* data, size_t len)
 {
-	assert(object.type == JSON_OBJECT && index < object.u.obj->len);
-	return object.u.obj->buckets + index;
-}
+	const json__snapshot_header_t* header = (const json__snapshot_header_t*)data;
 
-/**************************************************************************************************
-	JSON Array  */
+	if (data == NULL || len < sizeof(json__snapshot_header_t) || ((size_t)data & 7)
+		|| memcmp(header->magic, "JSNP", 4) != 0 || header->version != JSON__SNAPSHOT_VERSION
+		|| header->size > len)
+		return json__snapshot_at(NULL, JSON__SNAPSHOT_CONST(JSON_NONE));
 
-json__array_t json__array_new(int len)
-{
-	json__array_t array = { NULL, 0, 0 };
-	json__array_reserve(&array, len);
-	return array;
+	return json__snapshot_at(data, header->root);
 }
 
-void json__array_free(json__array_t* array)
+int json_snapshot_type(json_snapshot_value_t value)
 {
-	free(array->data);
+	return value.data ? json__box_type(value.word) : JSON_NONE;
 }
 
-void json__array_reserve(json__array_t* array, int len)
+int json_snapshot_number_type(json_snapshot_value_t number)
 {
-	if (array->cap < len)
-	{
-		json_t* new_data;
+	assert(json_snapshot_type(number) == JSON_NUMBER);
 
-		len = json__next_capacity(len);
-		new_data = malloc(sizeof(json_t) * (size_t)len);
-		array->cap = len;
+	if (number.word >> 48 != JSON__BOX_TAG + JSON_NUMBER)
+		return JSON_NUMBER_REAL;
 
-		memcpy(new_data, array->data, (size_t)array->len * sizeof(json_t));
-		json__array_free(array);
-		array->data = new_data;
-	}
+	return (int)((const json_uint64_t*)json__snapshot_record(number))[1];
 }
 
-void json__array_trim(json__array_t* array)
+double json_snapshot_number(json_snapshot_value_t number)
 {
-	if ((array->cap / 4) > array->len)
+	switch (json_snapshot_number_type(number))
 	{
-		array->cap = json__next_capacity(array->len * 2);
-		array->data = realloc(array->data, (size_t)array->cap * sizeof(json_t));
+	case JSON_NUMBER_INT:
+		return (double)json_snapshot_integer(number);
+	case JSON_NUMBER_UINT:
+		return (double)json_snapshot_uinteger(number);
 	}
+
+	return json__box_number(number.word);
 }
 
-json_t json_array_get(json_t array, int index)
+json_int64_t json_snapshot_integer(json_snapshot_value_t number)
 {
-	assert(array.type == JSON_ARRAY && index < array.u.arr->len);
-	return array.u.arr->data[index];
+	if (json_snapshot_number_type(number) == JSON_NUMBER_REAL)
+		return (json_int64_t)json__box_number(number.word);
+
+	return (json_int64_t)*(const json_uint64_t*)json__snapshot_record(number);
 }
 
-void json_array_set(json_t array, int index, json_t value)
+json_uint64_t json_snapshot_uinteger(json_snapshot_value_t number)
 {
-	json_t* _node;
+	if (json_snapshot_number_type(number) == JSON_NUMBER_REAL)
+		return (json_uint64_t)json__box_number(number.word);
 
-	assert(array.type == JSON_ARRAY && index < array.u.arr->len);
-	_node = array.u.arr->data + index;
+	return *(const json_uint64_t*)json__snapshot_record(number);
+}
 
-	json_free(*_node);
-	*_node = value;
+const char* json_snapshot_string(json_snapshot_value_t string)
+{
+	assert(json_snapshot_type(string) == JSON_STRING);
+	return json__snapshot_record(string) + sizeof(unsigned int);
 }
 
-void json_array_insert(json_t array, int index, json_t value)
+int json_snapshot_string_len(json_snapshot_value_t string)
 {
-	json__array_t* arr = array.u.arr;
-	json_t* dst, * src;
+	assert(json_snapshot_type(string) == JSON_STRING);
+	return (int)*(const unsigned int*)json__snapshot_record(string);
+}
 
-	assert(array.type == JSON_ARRAY && index <= array.u.arr->len);
+int json_snapshot_len(json_snapshot_value_t container)
+{
+	assert(json_snapshot_type(container) == JSON_OBJECT
+		|| json_snapshot_type(container) == JSON_ARRAY);
+	return (int)*(const unsigned int*)json__snapshot_record(container);
+}
 
-	json__array_reserve(arr, arr->len + 1);
-	src = arr->data + index;
-	dst = src + 1;
-	memmove(dst, src, (size_t)(arr->len - index) * sizeof(json_t));
-	*src = value;
-	arr->len++;
+/*	Members of an object, key offset and value  */
+static const json_uint64_t* json__snapshot_members(json_snapshot_value_t object)
+{
+	return (const json_uint64_t*)(json__snapshot_record(object) + 8);
 }
 
-void json_array_push(json_t array, json_t value)
+/*	The key and its length are compared in the snapshot, nothing is decoded.  */
+static int json__snapshot_key_eq(const char* data, json_uint64_t key, const char* str,
+	size_t len)
 {
-	assert(array.type == JSON_ARRAY);
-	json_array_insert(array, array.u.arr->len, value);
+	const char* record = data + (size_t)key;
+
+	return *(const unsigned int*)record == len
+		&& memcmp(record + sizeof(unsigned int), str, len) == 0;
 }
 
-json_t json_array_pop(json_t array, int index)
+json_snapshot_value_t json_snapshot_object_get(json_snapshot_value_t object, const char* key)
 {
-	json__array_t* arr = array.u.arr;
-	json_t* src, * dst, val = { JSON_NONE };
+	const char* record = json__snapshot_record(object);
+	const json_uint64_t* members = json__snapshot_members(object);
+	unsigned int len = ((const unsigned int*)record)[0], cap = ((const unsigned int*)record)[1];
+	size_t key_len = strlen(key);
 
-	assert(array.type == JSON_ARRAY && index < array.u.arr->len);
+	assert(json_snapshot_type(object) == JSON_OBJECT);
 
-	arr->len--;
-	dst = arr->data + index;
-	src = dst + 1;
-	val = *dst;
+	if (cap == 0)
+	{
+		unsigned int i;
 
-	memmove(dst, src, (size_t)(arr->len - index) * sizeof(json_t));
-	json__array_trim(arr);
-	return val;
-}
+		for (i = 0; i < len; i++)
+		{
+			if (json__snapshot_key_eq(object.data, members[i * 2], key, key_len))
+				return json__snapshot_at(object.data, members[i * 2 + 1]);
+		}
+	}
+	else
+	{
+		const unsigned int* sparse = (const unsigned int*)(members + 2 * (size_t)len);
+		const unsigned int* hashes = sparse + cap;
+		const unsigned char* info = (const unsigned char*)(hashes + cap);
+		unsigned int hash = json__hash(key, key_len,
+			((const json__snapshot_header_t*)object.data)->seed);
+		unsigned int mask = cap - 1, idx = hash & mask;
+		int distance = 0;
+
+		for (;; idx = (idx + 1) & mask, distance++)
+		{
+			int _distance = info[idx];
 
-void json_array_erase(json_t array, int index)
-{
-	json_t val = json_array_pop(array, index);
-	json_free(val);
-}
+			if ((_distance == 0xFF) | (distance > _distance))
+				break;
 
-int json_array_len(json_t array)
-{
-	assert(array.type == JSON_ARRAY);
-	return array.u.arr->len;
+			if (hashes[idx] == hash
+				&& json__snapshot_key_eq(object.data, members[sparse[idx] * 2], key, key_len))
+				return json__snapshot_at(object.data, members[sparse[idx] * 2 + 1]);
+		}
+	}
+
+	return json__snapshot_at(NULL, JSON__SNAPSHOT_CONST(JSON_NONE));
 }
 
-json_t* json_array_begin(json_t array)
+json_snapshot_value_t json_snapshot_array_get(json_snapshot_value_t array, int index)
 {
-	assert(array.type == JSON_ARRAY);
-	return array.u.arr->data;
+	assert(json_snapshot_type(array) == JSON_ARRAY);
+
+	if (index < 0 || index >= json_snapshot_len(array))
+		return json__snapshot_at(NULL, JSON__SNAPSHOT_CONST(JSON_NONE));
+
+	return json__snapshot_at(array.data,
+		((const json_uint64_t*)(json__snapshot_record(array) + 8))[index]);
 }
 
-json_t* json_array_end(json_t array)
+const char* json_snapshot_key(json_snapshot_value_t object, int index)
 {
-	assert(array.type == JSON_ARRAY);
-	return array.u.arr->data + array.u.arr->len;
+	assert(json_snapshot_type(object) == JSON_OBJECT);
+	assert(index >= 0 && index < json_snapshot_len(object));
+	return object.data + (size_t)json__snapshot_members(object)[index * 2] + sizeof(unsigned int);
 }
 
-json_t* json_array_at(json_t array, int index)
+json_snapshot_value_t json_snapshot_object_at(json_snapshot_value_t object, int index)
 {
-	assert(array.type == JSON_ARRAY && index < array.u.arr->len);
-	return array.u.arr->data + index;
+	assert(json_snapshot_type(object) == JSON_OBJECT);
+	assert(index >= 0 && index < json_snapshot_len(object));
+	return json__snapshot_at(object.data, json__snapshot_members(object)[index * 2 + 1]);
 }
 
 /**************************************************************************************************
@@ -847,34 +7638,84 @@ json_t* json_array_at(json_t array, int index)
 
 json__string_t json__string_new(int len)
 {
-	json__string_t str = { NULL, 0, 0 };
+	json__string_t str = { NULL, 0, 0, NULL };
 	json__string_reserve(&str, len);
 	return str;
 }
 
+/*	Strings up to JSON__STRING_INLINE characters are stored right behind their header, one
+	allocation for both. The data moves to its own buffer when the string grows.  */
+
+static json__string_t* json__string_alloc(json_arena_t* arena, size_t len)
+{
+	json__string_t* str;
+
+	if (len > JSON__STRING_INLINE)
+	{
+		if ((str = json__alloc(arena, sizeof(json__string_t))) == NULL)
+			return NULL;
+
+		str->data = NULL;
+		str->len = 0;
+		str->cap = 0;
+		str->arena = arena;
+		json__string_reserve(str, (int)len);
+		return str;
+	}
+
+	if ((str = json__alloc(arena, sizeof(json__string_t) + len + 1)) == NULL)
+		return NULL;
+
+	str->data = (char*)(str + 1);
+	str->data[0] = 0;
+	str->len = 0;
+	str->cap = (int)len + 1;
+	str->arena = arena;
+	return str;
+}
+
+/*	A string with a capacity of 0 borrows its data, it is copied when it grows.  */
+
 void json__string_free(json__string_t* str)
 {
-	free(str->data);
+	if (str->cap && !JSON__STRING_IS_INLINE(str))
+		json__dealloc(str->arena, str->data);
 }
 
-void json__string_reserve(json__string_t* str, int len)
+/*	Returns 0 and leaves the string as it is if the capacity would not fit an int or the
+	allocation fails.  */
+
+int json__string_reserve(json__string_t* str, int len)
 {
 	if (str->cap <= len)
 	{
 		char* new_data;
+		int cap;
+
+		if (len >= 0x40000000)
+			return 0;
+
+		cap = json__next_capacity(len + 1);
+
+		if ((new_data = (char*)json__alloc(str->arena, cap)) == NULL)
+			return 0;
+
+		if (str->len)
+			memcpy(new_data, str->data, str->len);
 
-		str->cap = json__next_capacity(len + 1);
-		new_data = (char*)malloc(str->cap);
-		memcpy(new_data, str->data, str->len);
 		new_data[str->len] = 0;
 		json__string_free(str);
 		str->data = new_data;
+		str->cap = cap;
 	}
+
+	return 1;
 }
 
 void json__string_trim(json__string_t* str)
 {
-	if ((str->cap / 4) > str->len)
+	if (str->arena == NULL && str->cap && !JSON__STRING_IS_INLINE(str)
+		&& (str->cap / 4) > str->len)
 	{
 		str->cap = json__next_capacity(str->len * 2);
 		str->data = realloc(str->data, (size_t)str->cap);
@@ -883,9 +7724,9 @@ void json__string_trim(json__string_t* str)
 
 void json_string_insert(json_t str, const char* seq, int len, int idx)
 {
-	json__string_t* string = str.u.str;
+	json__string_t* string = JSON__STR(str);
 
-	assert(str.type == JSON_STRING);
+	assert(JSON__TYPE(str) == JSON_STRING);
 
 	json__string_reserve(string, string->len + len);
 	memmove(string->data + idx + len, string->data + idx, string->len - idx);
@@ -896,15 +7737,15 @@ void json_string_insert(json_t str, const char* seq, int len, int idx)
 
 void json_string_append(json_t str, const char* seq, int len)
 {
-	assert(str.type == JSON_STRING);
-	json_string_insert(str, seq, len, str.u.str->len);
+	assert(JSON__TYPE(str) == JSON_STRING);
+	json_string_insert(str, seq, len, JSON__STR(str)->len);
 }
 
 void json_string_erase(json_t str, int idx, int len)
 {
-	json__string_t* string = str.u.str;
+	json__string_t* string = JSON__STR(str);
 
-	assert(str.type == JSON_STRING);
+	assert(JSON__TYPE(str) == JSON_STRING);
 
 	if ((idx + len) > string->len)
 		return;
@@ -917,26 +7758,146 @@ void json_string_erase(json_t str, int idx, int len)
 
 int json_string_len(json_t str)
 {
-	assert(str.type == JSON_STRING);
-	return str.u.str->len;
+	assert(JSON__TYPE(str) == JSON_STRING);
+	return JSON__STR(str)->len;
 }
 
 char* json_string_begin(json_t str)
 {
-	assert(str.type == JSON_STRING);
-	return str.u.str->data;
+	assert(JSON__TYPE(str) == JSON_STRING);
+	return JSON__STR(str)->data;
 }
 
 const char* json_string_end(json_t str)
 {
-	assert(str.type == JSON_STRING);
-	return str.u.str->data + str.u.str->len;
+	assert(JSON__TYPE(str) == JSON_STRING);
+	return JSON__STR(str)->data + JSON__STR(str)->len;
 }
 
 char* json_string_at(json_t str, int idx)
 {
-	assert(str.type == JSON_ARRAY && idx < str.u.str->len);
-	return str.u.str->data + idx;
+	assert(JSON__TYPE(str) == JSON_ARRAY && idx < JSON__STR(str)->len);
+	return JSON__STR(str)->data + idx;
+}
+
+/**************************************************************************************************
+	JSON Arena  */
+
+#define JSON__ARENA_ALIGN 8
+#define JSON__ARENA_BLOCK 0x10000
+#define JSON__ARENA_BLOCK_MAX 0x1000000
+
+typedef struct json__arena_block_t
+{
+	struct json__arena_block_t* next;
+	size_t size;
+
+} json__arena_block_t;
+
+#define JSON__ARENA_HEADER \
+	((sizeof(json__arena_block_t) + JSON__ARENA_ALIGN - 1) & ~(size_t)(JSON__ARENA_ALIGN - 1))
+
+json_arena_t* json_arena_new(size_t block_size)
+{
+	json_arena_t* arena = malloc(sizeof(json_arena_t));
+
+	if (arena == NULL)
+		return NULL;
+
+	arena->blocks = NULL;
+	arena->ptr = NULL;
+	arena->end = NULL;
+	arena->block_size = block_size ? block_size : JSON__ARENA_BLOCK;
+	return arena;
+}
+
+void* json_arena_alloc(json_arena_t* arena, size_t size)
+{
+	char* ptr;
+
+	size = (size + JSON__ARENA_ALIGN - 1) & ~(size_t)(JSON__ARENA_ALIGN - 1);
+
+	if ((size_t)(arena->end - arena->ptr) < size)
+	{
+		/* Start a new block, block sizes grow with the document to keep the block count low */
+		size_t block_size = arena->block_size;
+		json__arena_block_t* block;
+
+		if (block_size < size)
+			block_size = size;
+
+		block = malloc(JSON__ARENA_HEADER + block_size);
+
+		if (block == NULL)
+			return NULL;
+
+		block->next = arena->blocks;
+		block->size = block_size;
+		arena->blocks = block;
+		arena->ptr = (char*)block + JSON__ARENA_HEADER;
+		arena->end = arena->ptr + block_size;
+
+		if (arena->block_size < JSON__ARENA_BLOCK_MAX)
+			arena->block_size *= 2;
+	}
+
+	ptr = arena->ptr;
+	arena->ptr += size;
+	return ptr;
+}
+
+void json_arena_reset(json_arena_t* arena)
+{
+	json__arena_block_t* block = arena->blocks;
+
+	while (block)
+	{
+		json__arena_block_t* next = block->next;
+		free(block);
+		block = next;
+	}
+
+	arena->blocks = NULL;
+	arena->ptr = NULL;
+	arena->end = NULL;
+}
+
+void json_arena_free(json_arena_t* arena)
+{
+	if (arena == NULL)
+		return;
+
+	json_arena_reset(arena);
+	free(arena);
+}
+
+void json_arena_merge(json_arena_t* dst, json_arena_t* src)
+{
+	json__arena_block_t* last;
+
+	if (src->blocks == NULL)
+		return;
+
+	for (last = src->blocks; last->next; last = last->next)
+		;
+
+	/* the blocks of src go behind the block dst allocates from */
+
+	if (dst->blocks)
+	{
+		last->next = dst->blocks->next;
+		dst->blocks->next = src->blocks;
+	}
+	else
+	{
+		dst->blocks = src->blocks;
+		dst->ptr = src->ptr;
+		dst->end = src->end;
+	}
+
+	src->blocks = NULL;
+	src->ptr = NULL;
+	src->end = NULL;
 }
 
 /**************************************************************************************************
@@ -974,72 +7935,90 @@ int json__next_capacity(int len)
 	return (len < 4) ? 4 : 1 << (result + 1);
 }
 
-int json_dtoa(double value, int precision, char* buffer, int size)
+int json_dtoa(double value, char* buffer, int size)
 {
-	int exponent;
-	double divisor;
-	char* start = buffer;
+	char digits[20], out[JSON_DTOA_SIZE];
+	char* o = out;
+	json_uint64_t bits;
+	int len, exp10, point;
 
-	if (isnan(value))
-	{
-		memcpy(buffer, "nan", 4);
-		return 3;
-	}
+	memcpy(&bits, &value, sizeof(bits));
 
-	else if (isinf(value))
-	{
-		memcpy(buffer, "inf", 4);
-		return 3;
-	}
+	/* JSON has no infinity or NaN, null keeps the output valid */
 
-	if (value < 0.0)
+	if ((bits >> 52 & 0x7FF) == 0x7FF)
 	{
-		value = -value;
-		*buffer++ = '-';
+		memcpy(o, "null", 4);
+		o += 4;
 	}
-
-	exponent = (int)log10(value);
-
-	if (exponent < 0)
-		exponent = 0;
-
-	divisor = pow(10.0, (double)exponent);
-
-	while (precision)
+	else
 	{
-		double result = floor(value / divisor);
+		if (value < 0.0 || (value == 0.0 && 1.0 / value < 0.0))
+		{
+			value = -value;
+			*o++ = '-';
+		}
+
+		/* integers, including 0 */
 
-		double digit = fmod(result, 10);
+		if (value <= 9007199254740992.0 && value == (double)(json_int64_t)value)
+			o += json__itoa((json_uint64_t)value, 0, o);
+		else
+		{
+			len = json__grisu2(value, digits, &exp10);
+			point = len + exp10;
 
-		if (exponent == -1)
-			*buffer++ = '.';
+			if (len <= point && point <= 15)
+			{
+				/* 1e15 -> 1000000000000000 */
+				memcpy(o, digits, len);
+				memset(o + len, '0', point - len);
+				o += point;
+			}
+			else if (0 < point && point <= 15)
+			{
+				/* 12.34 */
+				memcpy(o, digits, point);
+				o[point] = '.';
+				memcpy(o + point + 1, digits + point, len - point);
+				o += len + 1;
+			}
+			else if (-4 < point && point <= 0)
+			{
+				/* 0.001234 */
+				o[0] = '0';
+				o[1] = '.';
+				memset(o + 2, '0', -point);
+				memcpy(o + 2 - point, digits, len);
+				o += 2 - point + len;
+			}
+			else
+			{
+				/* 1.234e+20, 1e-7 */
+				*o++ = digits[0];
 
-		*buffer++ = '0' + (int)digit;
+				if (len > 1)
+				{
+					*o++ = '.';
+					memcpy(o, digits + 1, len - 1);
+					o += len - 1;
+				}
 
-		if (exponent <= 0 && value - result * divisor <= 0.0)
-		{
-			exponent--;
-			break;
+				*o++ = 'e';
+				*o++ = point - 1 < 0 ? '-' : '+';
+				o += json__itoa((json_uint64_t)(point - 1 < 0 ? 1 - point : point - 1), 0, o);
+			}
 		}
-
-		divisor /= 10.0;
-		exponent--;
-		precision--;
 	}
 
-	if (exponent >= 0)
-	{
-		int div = (int)pow(10, floor(log10(++exponent)));
-
-		*buffer++ = 'e';
-		*buffer++ = '+';
+	len = (int)(o - out);
 
-		for (; div > 0; div /= 10)
-			*buffer++ = '0' + (exponent / div) % 10;
-	}
+	if (len >= size)
+		return 0;
 
-	*buffer = 0;
-	return (int)(buffer - start);
+	memcpy(buffer, out, len);
+	buffer[len] = 0;
+	return len;
 }
 
 const char* json_skip_whitespace(const char* c)
@@ -1050,31 +8029,20 @@ const char* json_skip_whitespace(const char* c)
 
 json__string_t json_parse_string_value(const char** p, int pad)
 {
-	json__string_t str = { NULL, 0, 0 };
-	const char* head = *p + 1;
-	const char* c = head;
+	json__string_t str = { NULL, 0, 0, NULL };
+	const char* head = *p;
+	const char* end = json__string_end(head, head + strlen(head));
 
-	while ((c = strchr(c, '"')) && *(c - 1) == '\\') c++;
-
-	if (c)
+	if (end)
 	{
-		str.len = (int)(c - head);
-		str.cap = pad ? json__next_capacity(str.len + 1) : str.len + 1;
-		str.data = malloc(str.cap);
+		str = json__string_slice(head + 1, (size_t)(end - head - 1), pad, NULL);
 
-		if (str.data == NULL)
-		{
-			str.len = 0;
-			str.cap = 0;
-			return str;
-		}
+		if (str.data)
+			*p = end + 1;
 
-		memcpy(str.data, head, str.len);
-		str.data[str.len] = 0;
-		*p = c + 1;
 		return str;
 	}
 
-	*p = head;
+	*p = head + 1;
 	return str;
-}
\ No newline at end of file
+}
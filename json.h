@@ -23,6 +23,14 @@
 
 #pragma once
 
+#include <stddef.h>
+#include <stdio.h>
+
+/*	Maximum nesting depth of parsed documents  */
+#ifndef JSON_MAX_DEPTH
+#define JSON_MAX_DEPTH 128
+#endif
+
 /**************************************************************************************************
 
 	Definitions
@@ -50,24 +58,64 @@ enum json_tokens
 	JSON_TOKEN_COUNT,
 };
 
+/*	Representation of JSON_NUMBER values  */
+enum json_number_types
+{
+	JSON_NUMBER_REAL,	/*	u.num  */
+	JSON_NUMBER_INT,	/*	u.i  */
+	JSON_NUMBER_UINT,	/*	u.u, only used above the int64 range  */
+};
+
 /*************************************************************************************************/
 
+#if defined(__GNUC__)
+__extension__ typedef long long json_int64_t;
+__extension__ typedef unsigned long long json_uint64_t;
+#elif defined(_MSC_VER)
+typedef __int64 json_int64_t;
+typedef unsigned __int64 json_uint64_t;
+#else
+typedef long long json_int64_t;
+typedef unsigned long long json_uint64_t;
+#endif
+
+/*************************************************************************************************/
+
+#if defined(JSON_NAN_BOXING)
+
+/*	JSON Value, 8 bytes. Numbers are stored as double, every other value is a quiet NaN with the
+	type in the upper and a pointer in the lower 48 bits. Pointers must fit into 48 bits, which is
+	the case for the user space of current x86-64 and AArch64 systems. Use the accessor functions
+	('json_type()', 'json_number_value()', ...) instead of the fields.  */
+typedef struct json_t
+{
+	json_uint64_t bits;
+
+} json_t;
+
+#else
+
 /* JSON Value, 16 bytes */
 typedef struct json_t
 {
 	int type;
+	int num_type;
 	union {
 		struct json__object_t* obj;
 		struct json__array_t* arr;
 		struct json__string_t* str;
 		double num;
+		json_int64_t i;
+		json_uint64_t u;
 	} u;
 
 } json_t;
 
+#endif
+
 /*************************************************************************************************/
 
-/* 24 bytes */
+/* 16 - 24 bytes */
 typedef struct json_bucket_t
 {
 	const char* key;
@@ -77,39 +125,210 @@ typedef struct json_bucket_t
 
 /*************************************************************************************************/
 
-/*	20 - 32 bytes  */
+/*	Object flags  */
+enum json__object_flags
+{
+	/*	Keys point into memory the object does not own (e.g. an in-situ buffer). They are copied
+		before a key is added.  */
+	JSON__BORROWED_KEYS = 1 << 0,
+};
+
+/*	32 - 56 bytes  */
 typedef struct json__object_t
 {
 	json_bucket_t* buckets;
 	int* sparse;
+	unsigned int* hashes;
 	unsigned char* info;
 	int len;
 	int cap;
+	int flags;
+	int deleted;
+	struct json_arena_t* arena;
 
 } json__object_t;
 
 /*************************************************************************************************/
 
-/*	12 - 16 bytes  */
+/*	16 - 24 bytes  */
 typedef struct json__array_t
 {
 	json_t* data;
 	int len;
 	int cap;
+	struct json_arena_t* arena;
 
 } json__array_t;
 
 /*************************************************************************************************/
 
-/*	12 - 16 bytes  */
+/*	16 - 24 bytes  */
 typedef struct json__string_t
 {
 	char* data;
 	int len;
 	int cap;
+	struct json_arena_t* arena;
 
 } json__string_t;
 
+/*************************************************************************************************/
+
+/*	Bump pointer allocator. Every node, key and string of an arena document is allocated from its
+	blocks, so the whole document is released at once by 'json_arena_free()'.  */
+typedef struct json_arena_t
+{
+	struct json__arena_block_t* blocks;
+	char* ptr;
+	char* end;
+	size_t block_size;
+
+} json_arena_t;
+
+/*	File mapped into memory, see 'json_file_map()'  */
+typedef struct json_file_t
+{
+	char* data;
+	size_t len;
+
+} json_file_t;
+
+/*************************************************************************************************/
+
+/*	Event callbacks of the parser, every callback may be NULL. Strings and keys are slices of the
+	input with escape sequences left in place, see 'json_unescape()', and are only valid during the
+	callback. Return 0 to stop parsing.  */
+typedef struct json_handler_t
+{
+	int (*object_begin)(void* ctx);
+	int (*object_end)(void* ctx);
+	int (*array_begin)(void* ctx);
+	int (*array_end)(void* ctx);
+	int (*key)(void* ctx, const char* str, size_t len);
+	int (*string)(void* ctx, const char* str, size_t len);
+	int (*number)(void* ctx, double value);
+
+	/*	Integers in the int64 and uint64 range. If NULL 'number' is called instead.  */
+	int (*integer)(void* ctx, json_int64_t value);
+	int (*uinteger)(void* ctx, json_uint64_t value);
+
+	int (*boolean)(void* ctx, int value);
+	int (*null)(void* ctx);
+
+} json_handler_t;
+
+/*	Decode the escape sequences of a string or key slice into dst, which needs room for len bytes
+	and may be src. Not terminated. Returns the decoded length or -1 if an escape is invalid.  */
+long json_unescape(char* dst, const char* src, size_t len);
+
+/*************************************************************************************************/
+
+/*	State of the DOM builder, a consumer of the parser events  */
+typedef struct json__dom_t
+{
+	json_t stack[JSON_MAX_DEPTH];
+	int depth;
+	int insitu;
+	const char* key;
+	const char** keys;
+	int keys_len;
+	int keys_cap;
+	json_arena_t* arena;
+
+} json__dom_t;
+
+/*************************************************************************************************/
+
+/*	Segment of a compiled JSON Pointer  */
+typedef struct json__pointer_step_t
+{
+	const char* key;
+	int len;
+	int index;
+	unsigned int hash;
+
+} json__pointer_step_t;
+
+/*	JSON Pointer (RFC 6901), see 'json_pointer_compile()'  */
+typedef struct json_pointer_t
+{
+	json__pointer_step_t* steps;
+	int len;
+
+} json_pointer_t;
+
+/*************************************************************************************************/
+
+/*	Value inside unparsed text, see 'json_lazy()'. 'text' points to the first character of the
+	value, 'end' to the end of the whole text.  */
+typedef struct json_lazy_t
+{
+	const char* text;
+	const char* end;
+
+} json_lazy_t;
+
+/*************************************************************************************************/
+
+/*	Resumable parser. Everything needed to continue with the next chunk of input is kept here: the
+	state machine, the container stack and the unfinished token at the end of the last chunk.  */
+typedef struct json_parser_t
+{
+	const json_handler_t* handler;
+	void* ctx;
+
+	unsigned char scope[JSON_MAX_DEPTH];
+	int depth;
+	int state;
+	int error;
+
+	/* unfinished token */
+	char* buffer;
+	size_t len;
+	size_t cap;
+
+	/* token offsets of stage one */
+	unsigned int* index;
+	size_t index_cap;
+
+	json__dom_t dom;
+
+} json_parser_t;
+
+
+/*	Read-only document in one flat array of tagged 64 bit words, see 'json_parse_tape()'. A
+	container stores the index behind its end word, so a whole subtree is skipped in one step.
+	Numbers are followed by a word with their value, strings and keys point into one buffer.  */
+typedef struct json_tape_t
+{
+	json_uint64_t* words;
+	size_t len;
+	size_t cap;
+
+	char* strings;
+	size_t strings_len;
+	size_t strings_cap;
+
+} json_tape_t;
+
+/*	Position of a value in a tape  */
+typedef struct json_tape_value_t
+{
+	const json_tape_t* tape;
+	size_t index;
+
+} json_tape_value_t;
+
+/*	Value in a snapshot, see 'json_snapshot()'. word is boxed like JSON_NAN_BOXING with offsets
+	into data instead of pointers.  */
+typedef struct json_snapshot_value_t
+{
+	const char* data;
+	json_uint64_t word;
+
+} json_snapshot_value_t;
+
+/*************************************************************************************************/
 
 /**************************************************************************************************
 
@@ -122,11 +341,221 @@ json_t json_object();
 json_t json_array();
 json_t json_string(const char* string);
 json_t json_number(double value);
+json_t json_integer(json_int64_t value);
+json_t json_uinteger(json_uint64_t value);
 json_t json_bool(int value);
 json_t json_null();
 void json_free(json_t value);
+
+/*	Type and number representation, the same as 'value.type' and 'value.num_type' but also
+	available with JSON_NAN_BOXING.  */
+int json_type(json_t value);
+int json_number_type(json_t number);
+
+/*	Parsed integers beyond 2^53 are stored exactly, use these to read any number.  */
+double json_number_value(json_t number);
+json_int64_t json_integer_value(json_t number);
+json_uint64_t json_uinteger_value(json_t number);
+
 json_t json_parse(const char* data);
+
+/*	Parse len bytes of text. The text needs no terminating 0, nothing past len is read.  */
+json_t json_parse_n(const char* text, size_t len);
+
+/*	Indentation of the dump functions. A positive value is the number of spaces per level.  */
+#define JSON_DUMP_COMPACT 0
+#define JSON_DUMP_TABS -1
+
+/*	Dump to a new string, 'json_dump()' indents with tabs. Returns JSON_NONE if memory runs out
+	or the text does not fit a string, which holds less than 1 GiB.  */
 json_t json_dump(json_t value);
+json_t json_dump_indent(json_t value, int indent);
+
+/*	Length of the dump without the terminating 0. 'json_dump_buffer()' writes into a buffer of
+	at least that size + 1 and returns the length, or 0 if the buffer is too small.  */
+size_t json_dump_size(json_t value, int indent);
+size_t json_dump_buffer(json_t value, int indent, char* buffer, size_t size);
+
+/*	Dump through a fixed buffer that is passed to 'write' whenever it fills up, memory use does
+	not depend on the size of the document. 'write' returns 0 to abort. All return 1 on success
+	and 0 if a write failed.  */
+typedef int (*json_write_fn)(void* ctx, const char* data, size_t len);
+
+int json_dump_to_writer(json_t value, int indent, json_write_fn write, void* ctx);
+int json_dump_file(json_t value, int indent, FILE* file);
+int json_dump_fd(json_t value, int indent, int fd);
+
+/*	Like 'json_dump_indent()', large containers are rendered on threads, 0 uses one thread per
+	processor. The output is the same as that of the sequential dump. A result string holds less
+	than 1 GiB, larger documents are dumped to a buffer or a writer. The writer receives the
+	rendered parts in order once all of them are done.  */
+json_t json_dump_parallel(json_t value, int indent, int threads);
+size_t json_dump_parallel_buffer(json_t value, int indent, int threads, char* buffer,
+	size_t size);
+int json_dump_parallel_to_writer(json_t value, int indent, int threads, json_write_fn write,
+	void* ctx);
+
+/**************************************************************************************************
+	JSON MessagePack  */
+
+/*	Encode to MessagePack in one pass, the buffer is allocated with malloc. Numbers that are
+	integers are encoded as integers, other numbers as float 32 if that is exact, else float 64.
+	Returns NULL if memory runs out.  */
+char* json_msgpack(json_t value, size_t* len);
+
+/*	Same as the dump functions: exact size, fixed buffer (0 if too small) and write callback.  */
+size_t json_msgpack_size(json_t value);
+size_t json_msgpack_buffer(json_t value, char* buffer, size_t size);
+int json_msgpack_to_writer(json_t value, json_write_fn write, void* ctx);
+
+/*	Decode MessagePack into a tree, into arena if it is not NULL. Map keys must be str or bin,
+	bin values become strings, extension types are invalid. Integers are stored like parsed JSON
+	numbers. Returns JSON_NONE if the data is invalid or has trailing bytes.  */
+json_t json_msgpack_parse(const char* data, size_t len, json_arena_t* arena);
+
+/**************************************************************************************************
+	JSON Arena  */
+
+/*	Create an arena. A block_size of 0 selects the default block size.  */
+json_arena_t* json_arena_new(size_t block_size);
+void* json_arena_alloc(json_arena_t* arena, size_t size);
+
+/*	Release every allocation of the arena, the arena itself stays usable.  */
+void json_arena_reset(json_arena_t* arena);
+void json_arena_free(json_arena_t* arena);
+
+/*	Move every block of src into dst, src stays usable and empty. Containers allocated from src
+	still grow from src, see 'json_parse_parallel()' for documents that are moved completely.  */
+void json_arena_merge(json_arena_t* dst, json_arena_t* src);
+
+/*	Parse into the arena. 'json_free()' is a no-op for the returned tree, it lives until the arena
+	is reset or freed. Containers of the tree keep allocating from the arena when they grow.
+	IMPORTANT: Values inserted into an arena container are not freed by 'json_arena_free()'.  */
+json_t json_parse_arena(const char* data, json_arena_t* arena);
+
+/*	Parse without copying strings. Strings and keys are decoded in place and terminated inside
+	buffer, the tree points into it, so buffer must outlive the tree. Strings and objects copy
+	their data when they are changed. If arena is not NULL the nodes are allocated from it.  */
+json_t json_parse_insitu(char* buffer, size_t len, json_arena_t* arena);
+
+/**************************************************************************************************
+	JSON File  */
+
+/*	Map a file into memory, NULL if it cannot be opened. The mapping is private: it can be parsed
+	in place with 'json_parse_insitu(file->data, file->len, arena)' so strings and keys point into
+	it, only pages that are written are copied and the file is never changed. The tree must not
+	outlive 'json_file_free()'.  */
+json_file_t* json_file_map(const char* path);
+void json_file_free(json_file_t* file);
+
+/*	Map, parse and unmap a file. Returns JSON_NONE if it cannot be read or is invalid.  */
+json_t json_parse_file(const char* path);
+
+/**************************************************************************************************
+	JSON Parser  */
+
+/*	Create a parser for chunked input. If arena is not NULL the document is parsed into it.  */
+json_parser_t* json_parser_new(json_arena_t* arena);
+
+/*	Create a parser that reports events to handler instead of building a document.  */
+json_parser_t* json_parser_new_sax(const json_handler_t* handler, void* ctx);
+
+/*	Parse the next chunk of input in place. Only a token that is cut off at the end of the chunk
+	is copied, together with the bytes of the next chunk that complete it. The chunk can be reused
+	when the function returns. Returns 0 if the input is invalid.  */
+int json_parser_feed(json_parser_t* parser, const char* chunk, size_t len);
+
+/*	Parse the remaining input and return the document. 'parser->error' is set if the input was
+	invalid or incomplete.  */
+json_t json_parser_finish(json_parser_t* parser);
+
+/*	Free the parser and the document if it was not finished.  */
+void json_parser_free(json_parser_t* parser);
+
+/*	Parse text and report events to handler without building a document. Nothing is allocated per
+	value. Returns 1 if the text is a valid document.  */
+int json_parse_sax(const char* text, size_t len, const json_handler_t* handler, void* ctx);
+
+/**************************************************************************************************
+	JSON Lines  */
+
+/*	Called for every record of newline delimited JSON in input order. line is the zero based line
+	of the record, invalid records are passed as JSON_NONE. Return 0 to stop.  */
+typedef int (*json_record_fn)(void* ctx, json_t record, size_t line);
+
+/*	Parse one record per line on threads, 0 uses one thread per processor. Blank lines are
+	skipped. Records are parsed into arenas of the parser and are only valid during the callback.
+	Returns 1 if every record was valid and passed to the callback.  */
+int json_parse_lines(const char* text, size_t len, int threads, json_record_fn record, void* ctx);
+
+/*	Array of all records in input order, JSON_NONE if a record is invalid.  */
+json_t json_parse_lines_array(const char* text, size_t len, int threads);
+
+/**************************************************************************************************
+	JSON Parallel  */
+
+/*	Parse a document whose root is a large array on threads, 0 uses one thread per processor. The
+	elements are split into ranges that are parsed in parallel and joined in order. Other and
+	small documents are parsed on the calling thread. If arena is not NULL the document is parsed
+	into it like 'json_parse_arena()'.  */
+json_t json_parse_parallel(const char* text, size_t len, int threads, json_arena_t* arena);
+
+/**************************************************************************************************
+	JSON Tape  */
+
+/*	Parse text into a tape. Needs a handful of allocations per document instead of one per value,
+	'json_tape_free()' releases everything. Returns NULL if the text is invalid.  */
+json_tape_t* json_parse_tape(const char* text, size_t len);
+void json_tape_free(json_tape_t* tape);
+
+/*	Values that do not exist, like the result of a failed lookup or the position behind the last
+	element, have the type JSON_NONE.  */
+json_tape_value_t json_tape_root(const json_tape_t* tape);
+int json_tape_type(json_tape_value_t value);
+int json_tape_number_type(json_tape_value_t number);
+double json_tape_number(json_tape_value_t number);
+json_int64_t json_tape_integer(json_tape_value_t number);
+json_uint64_t json_tape_uinteger(json_tape_value_t number);
+const char* json_tape_string(json_tape_value_t string);
+int json_tape_string_len(json_tape_value_t string);
+
+/*	Number of elements or members of a container  */
+int json_tape_len(json_tape_value_t container);
+json_tape_value_t json_tape_object_get(json_tape_value_t object, const char* key);
+json_tape_value_t json_tape_array_get(json_tape_value_t array, int index);
+
+/*	Iterate the elements of an array or the values of an object. 'json_tape_key()' returns the
+	key of a value that was reached by iterating an object:
+
+	for (i = json_tape_begin(object); json_tape_type(i) != JSON_NONE; i = json_tape_next(i))
+		printf("%s\n", json_tape_key(i));  */
+json_tape_value_t json_tape_begin(json_tape_value_t container);
+json_tape_value_t json_tape_next(json_tape_value_t value);
+const char* json_tape_key(json_tape_value_t value);
+
+/**************************************************************************************************
+	JSON Lazy  */
+
+/*	Navigate text without parsing it, the text must outlive the values. Siblings on the way are
+	skipped by matching brackets and strings only, so a lookup costs the text in front of the
+	value and not the whole document. Only 'json_lazy_value()' parses and validates.  */
+json_lazy_t json_lazy(const char* text, size_t len);
+
+/*	Literals are checked in full, JSON_NONE if misspelled. The type of numbers, strings and
+	containers is read from their first character and holds once 'json_lazy_value()' succeeds.  */
+int json_lazy_type(json_lazy_t value);
+
+/*	The first member with the key. Missing values have the type JSON_NONE.  */
+json_lazy_t json_lazy_get(json_lazy_t object, const char* key);
+json_lazy_t json_lazy_at(json_lazy_t array, int index);
+
+/*	Follow a NULL terminated path of keys, steps into arrays are decimal indices:
+	json_lazy_find(doc, "data", "items", "0", "id", NULL)  */
+json_lazy_t json_lazy_find(json_lazy_t value, ...);
+
+/*	Parse the value, JSON_NONE if it is invalid. 'json_lazy_len()' is the length of its text.  */
+json_t json_lazy_value(json_lazy_t value);
+size_t json_lazy_len(json_lazy_t value);
 
 /**************************************************************************************************
 	JSON Object  */
@@ -135,9 +564,24 @@ json__object_t json__object_new(int len);
 void json__object_free(json__object_t* object);
 void json__object_reserve(json__object_t* object, int len);
 void json__object_trim(json__object_t* object);
-json_t* json__object_get_index(json__object_t* object, const char* key, int hash, int* out_index);
+json_t* json__object_get_index(json__object_t* object, const char* key, unsigned int hash,
+	int* out_index);
+
+/*	With copy_key the key is copied. Without it the object takes over key, which must have been
+	allocated by 'json_key_new()', its hash and length are stored in front of it. Objects in an
+	arena never free keys, use copy_key for them.  */
 void json__object_set(json__object_t* object, const char* key, json_t value, int copy_key);
 
+/*	Allocate a key that can be handed over to 'json__object_set()', len characters are copied and
+	may include NUL characters. Keys that are not handed over are freed with 'json_key_free()'.
+	Allocate keys after 'json_hash_seed()', the hash depends on the seed.  */
+char* json_key_new(const char* key, size_t len);
+void json_key_free(char* key);
+
+/*	Keys are hashed with a random seed per process. Set a fixed seed before creating any object
+	and before other threads use the library to get reproducible hashes.  */
+void json_hash_seed(json_uint64_t seed);
+
 json_t json_object_get(json_t object, const char* key);
 void json_object_set(json_t object, const char* key, json_t value);
 json_t json_object_pop(json_t object, const char* key);
@@ -184,12 +628,55 @@ json_t* json_array_end(json_t array);
 /*	IMPORTANT: Call 'json_free()' on old value before you replace it!  */
 json_t* json_array_at(json_t array, int index);
 
+/**************************************************************************************************
+	JSON Pointer  */
+
+/*	Compile a JSON Pointer like "/users/0/address/city". Keys are unescaped and hashed once, so
+	resolving it does not hash or measure keys again. Returns NULL if the syntax is invalid.
+	Compile pointers after 'json_hash_seed()', the hashes depend on the seed.  */
+json_pointer_t* json_pointer_compile(const char* pointer);
+void json_pointer_free(json_pointer_t* pointer);
+
+/*	The value the pointer refers to or JSON_NONE. The value is owned by the document.  */
+json_t json_pointer_get(json_t value, const json_pointer_t* pointer);
+
+/**************************************************************************************************
+	JSON Snapshot  */
+
+/*	Write value into one relocatable buffer allocated with malloc, to be saved and read back
+	without parsing. Objects keep their hash index, strings their length. Returns NULL if memory
+	runs out.  */
+char* json_snapshot(json_t value, size_t* len);
+
+/*	Open a snapshot in memory, for example mapped with 'json_file_map()'. data must be aligned to
+	8 bytes and outlive the values. Only the header is checked, the snapshot must come from
+	'json_snapshot()' on a machine of the same byte order. Returns JSON_NONE if the header is
+	invalid.  */
+json_snapshot_value_t json_snapshot_root(const char* data, size_t len);
+
+/*	Read-only access like the tape, values that do not exist have the type JSON_NONE.  */
+int json_snapshot_type(json_snapshot_value_t value);
+int json_snapshot_number_type(json_snapshot_value_t number);
+double json_snapshot_number(json_snapshot_value_t number);
+json_int64_t json_snapshot_integer(json_snapshot_value_t number);
+json_uint64_t json_snapshot_uinteger(json_snapshot_value_t number);
+const char* json_snapshot_string(json_snapshot_value_t string);
+int json_snapshot_string_len(json_snapshot_value_t string);
+
+/*	Number of elements or members of a container. Lookups are O(1) for arrays and hashed objects,
+	members are iterated by index in insertion order.  */
+int json_snapshot_len(json_snapshot_value_t container);
+json_snapshot_value_t json_snapshot_object_get(json_snapshot_value_t object, const char* key);
+json_snapshot_value_t json_snapshot_array_get(json_snapshot_value_t array, int index);
+const char* json_snapshot_key(json_snapshot_value_t object, int index);
+json_snapshot_value_t json_snapshot_object_at(json_snapshot_value_t object, int index);
+
 /**************************************************************************************************
 	JSON String  */
 
 json__string_t json__string_new(int len);
 void json__string_free(json__string_t* str);
-void json__string_reserve(json__string_t* str, int len);
+int json__string_reserve(json__string_t* str, int len);
 
 /*	Trim string to lowest fitting capacity  */
 void json__string_trim(json__string_t* str);
@@ -207,7 +694,12 @@ char* json_string_at(json_t str, int idx);
 	Helper functions  */
 
 int json__next_capacity(int len);
-int json_dtoa(double value, int precision, char* buffer, int size);
+
+/*	Shortest text that reads back as the same double. Infinity and NaN are written as null, so
+	dumped documents stay valid JSON. Returns the length or 0 if buffer is smaller than needed,
+	JSON_DTOA_SIZE is always enough.  */
+#define JSON_DTOA_SIZE 32
+int json_dtoa(double value, char* buffer, int size);
 const char* json_skip_whitespace(const char* c);
 
 /*	If pad is enabled more memory than needed will be allocated. This reduces the number of reallo-